@@ -0,0 +1,58 @@
+#include <chrono>
+#include <vector>
+#include "bench.hpp"
+#include "bitfilled.hpp"
+#include "bitfilled/async.hpp"
+
+using namespace bench;
+using namespace std::chrono_literals;
+
+namespace
+{
+struct sensor_t : bitfilled::async_device<sensor_t>
+{
+    using async_device::async_device;
+
+    struct TEMP_t : BF_ASYNCREG(std::uint16_t, r, 0x02)
+    {
+        BF_MMREGBITS(std::int16_t, r, 4, 15) celsius_16th;
+    };
+    [[no_unique_address]] TEMP_t TEMP;
+};
+
+bitfilled::async_task<> read_temp(sensor_t& sensor, int& sum)
+{
+    sum += co_await bitfilled::async_read(sensor.TEMP.celsius_16th);
+}
+
+/// @brief  Reads a field of 16 sensors concurrently, over a bus with 20 us latency,
+///         which carries the given number of requests at once.
+template <std::size_t DEPTH>
+void read_sensors(std::size_t iterations)
+{
+    constexpr std::size_t sensors = 16;
+    bitfilled::loopback_transport registers{4};
+    bitfilled::async_executor executor;
+    bitfilled::latency_transport bus{registers, executor, 20us, DEPTH};
+    sensor_t sensor{bus};
+    int sum = 0;
+    std::vector<bitfilled::async_task<>> tasks;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        tasks.clear();
+        for (std::size_t s = 0; s < sensors; ++s)
+        {
+            tasks.push_back(read_temp(sensor, sum));
+            executor.start(tasks.back());
+        }
+        executor.run();
+    }
+    do_not_optimize(sum);
+}
+} // namespace
+
+const suite async = []
+{
+    "async/sequential"_bench = read_sensors<1>;
+    "async/pipelined"_bench = read_sensors<16>;
+};
@@ -0,0 +1,102 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench.hpp"
+#include "bitfilled.hpp"
+#include "bitfilled/atomic_ops.hpp"
+
+using namespace bench;
+
+namespace
+{
+// the same shared word of flags and counters, updated by all threads
+template <typename TOps>
+struct shared_word : bitfilled::host_integer<std::uint64_t, TOps>
+{
+    using superclass = bitfilled::host_integer<std::uint64_t, TOps>;
+    BF_COPY_SUPERCLASS(shared_word);
+    using bf_ops = typename superclass::bf_ops;
+
+    BF_BITSET(bool, 1, 64) flags BF_BITSET_POSTFIX;
+    BF_BITSET(std::uint8_t, 4, 16) counters BF_BITSET_POSTFIX;
+};
+
+using atomic_word = shared_word<bitfilled::atomic<>>;
+using locked_word = shared_word<bitfilled::base>;
+
+/// @brief  Splits the iterations among the threads, each updating its own fields
+///         (with the thread's index) of the same word.
+template <std::size_t THREADS, typename TAccess>
+void run(std::size_t iterations, TAccess access)
+{
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < THREADS; ++t)
+    {
+        threads.emplace_back([&access, t, count = iterations / THREADS]
+        {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                access(t, i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+template <std::size_t THREADS>
+void atomic_bit(std::size_t iterations)
+{
+    static atomic_word word{};
+    run<THREADS>(iterations, [](std::size_t t, std::size_t i) { word.flags[t] = (i % 2) == 0; });
+}
+template <std::size_t THREADS>
+void locked_bit(std::size_t iterations)
+{
+    static locked_word word{};
+    static std::mutex mutex;
+    run<THREADS>(iterations, [](std::size_t t, std::size_t i)
+    {
+        const std::lock_guard lock(mutex);
+        word.flags[t] = (i % 2) == 0;
+    });
+}
+template <std::size_t THREADS>
+void atomic_field(std::size_t iterations)
+{
+    static atomic_word word{};
+    run<THREADS>(iterations, [](std::size_t t, std::size_t i)
+    {
+        word.counters[t % 16] = static_cast<std::uint8_t>(i);
+    });
+}
+template <std::size_t THREADS>
+void locked_field(std::size_t iterations)
+{
+    static locked_word word{};
+    static std::mutex mutex;
+    run<THREADS>(iterations, [](std::size_t t, std::size_t i)
+    {
+        const std::lock_guard lock(mutex);
+        word.counters[t % 16] = static_cast<std::uint8_t>(i);
+    });
+}
+} // namespace
+
+#define ATOMIC_BENCHES(THREADS)                                                                    \
+    "atomic/set/bit/" #THREADS ""_bench = atomic_bit<THREADS>;                                     \
+    "atomic/set/bit/mutex/" #THREADS ""_bench = locked_bit<THREADS>;                               \
+    "atomic/set/field/" #THREADS ""_bench = atomic_field<THREADS>;                                 \
+    "atomic/set/field/mutex/" #THREADS ""_bench = locked_field<THREADS>
+
+const suite atomic = []
+{
+    ATOMIC_BENCHES(2);
+    ATOMIC_BENCHES(4);
+    ATOMIC_BENCHES(8);
+    ATOMIC_BENCHES(16);
+    ATOMIC_BENCHES(32);
+    ATOMIC_BENCHES(64);
+};
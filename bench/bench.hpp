@@ -0,0 +1,215 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <vector>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/// A minimal microbenchmark harness, mirroring the boost::ut suite style.
+namespace bench
+{
+/// @brief  Forces the compiler to materialize the value in memory,
+///         and to assume that it is read and modified.
+template <typename T>
+inline void do_not_optimize(T& value)
+{
+#if defined(__GNUC__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/// @brief  A benchmark body runs the measured operation the given number of times.
+using body = std::function<void(std::size_t iterations)>;
+
+struct benchmark
+{
+    std::string_view name;
+    body run;
+    /// the number of bytes processed by an iteration, for the throughput (or zero)
+    std::size_t bytes;
+};
+
+inline std::vector<benchmark>& registry()
+{
+    static std::vector<benchmark> benchmarks;
+    return benchmarks;
+}
+
+struct suite
+{
+    template <class F>
+    suite(F f)
+    {
+        f();
+    }
+};
+
+struct named
+{
+    std::string_view name;
+    std::size_t bytes{};
+
+    /// @brief  Reports the throughput of the benchmark, processing the given bytes per iteration.
+    named processing(std::size_t bytes_per_op) const { return {name, bytes_per_op}; }
+
+    template <class F>
+    void operator=(F f)
+    {
+        registry().push_back({name, f, bytes});
+    }
+};
+inline named operator""_bench(const char* name, std::size_t size) { return {{name, size}}; }
+
+/// @brief  Counts the retired instructions of the current thread, where the platform allows it
+///         (Linux perf events), otherwise it reports no value.
+class instruction_counter
+{
+  public:
+    instruction_counter()
+    {
+#if defined(__linux__)
+        perf_event_attr attr{};
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+    }
+    ~instruction_counter()
+    {
+#if defined(__linux__)
+        if (fd_ >= 0)
+        {
+            close(fd_);
+        }
+#endif
+    }
+    instruction_counter(const instruction_counter&) = delete;
+    instruction_counter& operator=(const instruction_counter&) = delete;
+
+    [[nodiscard]] bool available() const { return fd_ >= 0; }
+
+    void start()
+    {
+#if defined(__linux__)
+        if (available())
+        {
+            ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+    std::optional<std::uint64_t> stop()
+    {
+#if defined(__linux__)
+        std::uint64_t count{};
+        if (available() and (ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0) == 0) and
+            (read(fd_, &count, sizeof(count)) == sizeof(count)))
+        {
+            return count;
+        }
+#endif
+        return std::nullopt;
+    }
+
+  private:
+    int fd_ = -1;
+};
+
+struct result
+{
+    double ns;
+    std::optional<double> instructions;
+};
+
+/// @brief  Measures the average time (in nanoseconds) and instruction count
+///         of a single iteration of the benchmark.
+inline result measure(const body& run, instruction_counter& counter)
+{
+    using clock = std::chrono::steady_clock;
+    constexpr auto min_duration = std::chrono::milliseconds(20);
+    constexpr int repetitions = 5;
+
+    // find an iteration count that runs long enough for the clock resolution
+    std::size_t iterations = 1;
+    for (;; iterations *= 2)
+    {
+        const auto start = clock::now();
+        run(iterations);
+        if ((clock::now() - start) >= min_duration)
+        {
+            break;
+        }
+    }
+    // take the best of a few repetitions, to filter out the noise
+    auto best = std::chrono::duration<double, std::nano>::max();
+    std::optional<std::uint64_t> instructions;
+    for (int i = 0; i < repetitions; ++i)
+    {
+        counter.start();
+        const auto start = clock::now();
+        run(iterations);
+        const auto duration = clock::now() - start;
+        const auto count = counter.stop();
+        best = std::min<std::chrono::duration<double, std::nano>>(best, duration);
+        if (count and (not instructions or (*count < *instructions)))
+        {
+            instructions = count;
+        }
+    }
+    const auto per_op = [iterations](double total) { return total / static_cast<double>(iterations); };
+    return {per_op(best.count()),
+            instructions ? std::optional(per_op(static_cast<double>(*instructions))) : std::nullopt};
+}
+
+/// @brief  Runs all registered benchmarks whose name contains the filter.
+inline int run_all(std::string_view filter)
+{
+    instruction_counter counter;
+    std::printf("%-48s %12s %12s %12s\n", "benchmark", "ns/op", "instr/op", "GB/s");
+    for (const auto& benchmark : registry())
+    {
+        if (benchmark.name.find(filter) == std::string_view::npos)
+        {
+            continue;
+        }
+        const auto [ns, instructions] = measure(benchmark.run, counter);
+        std::printf("%-48.*s %12.3f", static_cast<int>(benchmark.name.size()),
+                    benchmark.name.data(), ns);
+        if (instructions)
+        {
+            std::printf(" %12.1f", *instructions);
+        }
+        else
+        {
+            std::printf(" %12s", "n/a");
+        }
+        if (benchmark.bytes > 0)
+        {
+            // bytes per nanosecond
+            std::printf(" %12.3f\n", static_cast<double>(benchmark.bytes) / ns);
+        }
+        else
+        {
+            std::printf(" %12s\n", "-");
+        }
+    }
+    return 0;
+}
+
+} // namespace bench
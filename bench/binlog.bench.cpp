@@ -0,0 +1,59 @@
+#include <cstdio>
+#include "bench.hpp"
+#include "bitfilled.hpp"
+#include "bitfilled/binlog.hpp"
+
+using namespace bench;
+
+namespace
+{
+struct status_reg : bitfilled::host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(status_reg);
+
+    BF_BITS(std::uint8_t, 0, 3) state;
+    BF_BITS(bool, 4) err;
+    BF_BITS(std::uint16_t, 8, 19) count;
+    BF_BITS(std::int8_t, 24, 31) trim;
+};
+} // namespace
+
+BF_LAYOUT(status_reg, state, err, count, trim);
+
+namespace
+{
+/// @brief  The same snapshots, either decoded and formatted, or logged raw.
+template <bool RAW>
+void log_status(std::size_t iterations)
+{
+    status_reg reg{};
+    char line[96];
+    auto& log = bitfilled::binlog<>::local();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        reg = static_cast<std::uint32_t>(i * 2654435761u);
+        do_not_optimize(reg);
+        if constexpr (RAW)
+        {
+            log.append(reg);
+            if (log.records().size() > (log.capacity() - 64))
+            {
+                log.clear();
+            }
+        }
+        else
+        {
+            std::snprintf(line, sizeof(line), "status_reg state=%u err=%d count=%u trim=%d\n",
+                          static_cast<unsigned>(reg.state), static_cast<int>(reg.err),
+                          static_cast<unsigned>(reg.count), static_cast<int>(reg.trim));
+            do_not_optimize(line);
+        }
+    }
+}
+} // namespace
+
+const suite binlog = []
+{
+    "binlog/snprintf"_bench = log_status<false>;
+    "binlog/raw"_bench = log_status<true>;
+};
@@ -0,0 +1,117 @@
+#include <bitset>
+#include "bench.hpp"
+#include "bitfilled/bitarray.hpp"
+
+using namespace bench;
+
+namespace
+{
+constexpr std::size_t BITS = 4096;
+
+// pseudo-random positions to free up in an otherwise full allocator
+const std::vector<std::size_t>& positions()
+{
+    static const auto values = []
+    {
+        std::vector<std::size_t> v(1024);
+        std::size_t x = 12345;
+        for (auto& pos : v)
+        {
+            x = (x * 1103515245 + 12345) % 2147483648;
+            pos = x % BITS;
+        }
+        return v;
+    }();
+    return values;
+}
+
+template <typename T>
+std::size_t find_first_zero(const T& bits)
+{
+    if constexpr (requires { bits.find_first_zero(); })
+    {
+        return bits.find_first_zero();
+    }
+    else
+    {
+        std::size_t pos = 0;
+        while ((pos < bits.size()) and bits.test(pos))
+        {
+            ++pos;
+        }
+        return pos;
+    }
+}
+
+template <typename T>
+void fill_range(T& bits, std::size_t first, std::size_t count)
+{
+    if constexpr (requires { bits.set_range(first, count); })
+    {
+        bits.set_range(first, count);
+    }
+    else
+    {
+        for (std::size_t pos = first; pos < first + count; ++pos)
+        {
+            bits.set(pos);
+        }
+    }
+}
+
+template <typename T>
+void allocate(std::size_t iterations)
+{
+    T bits;
+    fill_range(bits, 0, BITS);
+    const auto& free_list = positions();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bits.reset(free_list[i % free_list.size()]);
+        do_not_optimize(bits);
+        auto pos = find_first_zero(bits);
+        bits.set(pos);
+        do_not_optimize(pos);
+    }
+}
+
+template <typename T>
+void count(std::size_t iterations)
+{
+    T bits;
+    for (auto pos : positions())
+    {
+        bits.set(pos);
+    }
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        do_not_optimize(bits);
+        auto n = bits.count();
+        do_not_optimize(n);
+    }
+}
+
+template <typename T>
+void set_range(std::size_t iterations)
+{
+    T bits;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        fill_range(bits, i % 64, BITS / 2);
+        do_not_optimize(bits);
+    }
+}
+} // namespace
+
+const suite bitarray = []
+{
+    using bitarray_type = bitfilled::host_bitarray<BITS, std::uint64_t>;
+    using bitset_type = std::bitset<BITS>;
+
+    "bitarray/allocate/host_bitarray"_bench = allocate<bitarray_type>;
+    "bitarray/allocate/std::bitset"_bench = allocate<bitset_type>;
+    "bitarray/count/host_bitarray"_bench = count<bitarray_type>;
+    "bitarray/count/std::bitset"_bench = count<bitset_type>;
+    "bitarray/set_range/host_bitarray"_bench = set_range<bitarray_type>;
+    "bitarray/set_range/std::bitset"_bench = set_range<bitset_type>;
+};
@@ -0,0 +1,109 @@
+#include <array>
+#include <numeric>
+#include <vector>
+#include "bench.hpp"
+#include "bitfilled.hpp"
+#include "bitfilled/bitstream.hpp"
+
+using namespace bench;
+
+namespace
+{
+// a codec-like mix of field widths, repeated over the stream
+constexpr std::array<std::size_t, 8> WIDTHS{3, 5, 12, 1, 7, 20, 9, 31};
+constexpr std::size_t PATTERN_BITS = std::accumulate(WIDTHS.begin(), WIDTHS.end(), std::size_t{});
+constexpr std::size_t REPEATS = 1024;
+constexpr std::size_t STREAM_BYTES = PATTERN_BITS * REPEATS / 8;
+
+struct slice_header : bitfilled::host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(slice_header);
+
+    BF_BITS(std::uint8_t, 20, 23) type;
+    BF_BITS(bool, 19) flag;
+    BF_BITS(std::uint32_t, 0, 18) id;
+};
+
+template <bitfilled::bit_order ORDER>
+std::vector<std::byte> encoded_stream()
+{
+    std::vector<std::byte> bytes(STREAM_BYTES);
+    bitfilled::bit_writer<ORDER> writer{std::span{bytes}};
+    std::uint64_t x = 12345;
+    for (std::size_t i = 0; i < REPEATS; ++i)
+    {
+        for (auto width : WIDTHS)
+        {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            writer.write(x >> 17, width);
+        }
+    }
+    writer.flush();
+    return bytes;
+}
+
+template <bitfilled::bit_order ORDER>
+void read_fields(std::size_t iterations)
+{
+    static const auto bytes = encoded_stream<ORDER>();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bitfilled::bit_reader<ORDER> reader{std::span<const std::byte>{bytes}};
+        std::uint64_t sum = 0;
+        for (std::size_t r = 0; r < REPEATS; ++r)
+        {
+            for (auto width : WIDTHS)
+            {
+                sum += reader.read(width);
+            }
+        }
+        do_not_optimize(sum);
+    }
+}
+
+template <bitfilled::bit_order ORDER>
+void write_fields(std::size_t iterations)
+{
+    std::vector<std::byte> bytes(STREAM_BYTES);
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bitfilled::bit_writer<ORDER> writer{std::span{bytes}};
+        for (std::size_t r = 0; r < REPEATS; ++r)
+        {
+            for (auto width : WIDTHS)
+            {
+                writer.write(r, width);
+            }
+        }
+        writer.flush();
+        do_not_optimize(bytes);
+    }
+}
+
+void read_layouts(std::size_t iterations)
+{
+    static const auto bytes = encoded_stream<bitfilled::bit_order::msb_first>();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bitfilled::bit_reader reader{std::span<const std::byte>{bytes}};
+        std::uint32_t sum = 0;
+        // the whole stream, as 24-bit headers
+        for (std::size_t r = 0; r < (STREAM_BYTES / 3); ++r)
+        {
+            const auto header = reader.read<slice_header, 24>();
+            sum += header.flag ? header.id : header.type;
+        }
+        do_not_optimize(sum);
+    }
+}
+} // namespace
+
+const suite bitstream = []
+{
+    using enum bitfilled::bit_order;
+    "bitstream/read/msb_first"_bench.processing(STREAM_BYTES) = read_fields<msb_first>;
+    "bitstream/read/lsb_first"_bench.processing(STREAM_BYTES) = read_fields<lsb_first>;
+    "bitstream/write/msb_first"_bench.processing(STREAM_BYTES) = write_fields<msb_first>;
+    "bitstream/write/lsb_first"_bench.processing(STREAM_BYTES) = write_fields<lsb_first>;
+    "bitstream/read/layout"_bench.processing(STREAM_BYTES / 3 * 3) = read_layouts;
+};
@@ -0,0 +1,100 @@
+#include <vector>
+#include "bench.hpp"
+#include "bitfilled.hpp"
+#include "bitfilled/column.hpp"
+
+using namespace bench;
+
+namespace
+{
+constexpr std::size_t RECORDS = 1 << 16;
+
+struct record : bitfilled::host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(record);
+
+    BF_BITS(std::uint8_t, 1, 2) enumerated;
+    BF_BITS(std::int32_t, 3, 9) delta;
+};
+
+std::vector<record>& records()
+{
+    static auto values = []
+    {
+        std::vector<record> v(RECORDS);
+        std::uint32_t x = 12345;
+        for (auto& rec : v)
+        {
+            x = x * 1103515245u + 12345u;
+            rec = x;
+        }
+        return v;
+    }();
+    return values;
+}
+
+template <auto MEMBER, typename T>
+void extract_loop(std::size_t iterations)
+{
+    const auto& recs = records();
+    std::vector<T> out(recs.size());
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        for (std::size_t j = 0; j < recs.size(); ++j)
+        {
+            out[j] = recs[j].*MEMBER;
+        }
+        do_not_optimize(out);
+    }
+}
+
+template <auto MEMBER, typename T>
+void extract_column(std::size_t iterations)
+{
+    const auto& recs = records();
+    std::vector<T> out(recs.size());
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bitfilled::extract_column(std::span{recs}, MEMBER, std::span{out});
+        do_not_optimize(out);
+    }
+}
+
+template <auto MEMBER, typename T>
+void scatter_loop(std::size_t iterations)
+{
+    auto& recs = records();
+    std::vector<T> in(recs.size(), 1);
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        for (std::size_t j = 0; j < recs.size(); ++j)
+        {
+            recs[j].*MEMBER = in[j];
+        }
+        do_not_optimize(recs);
+    }
+}
+
+template <auto MEMBER, typename T>
+void scatter_column(std::size_t iterations)
+{
+    auto& recs = records();
+    std::vector<T> in(recs.size(), 1);
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bitfilled::scatter_column(std::span{recs}, MEMBER, std::span{in});
+        do_not_optimize(recs);
+    }
+}
+} // namespace
+
+const suite column = []
+{
+    "column/extract/unsigned/loop"_bench = extract_loop<&record::enumerated, std::uint8_t>;
+    "column/extract/unsigned/extract_column"_bench =
+        extract_column<&record::enumerated, std::uint8_t>;
+    "column/extract/signed/loop"_bench = extract_loop<&record::delta, std::int32_t>;
+    "column/extract/signed/extract_column"_bench = extract_column<&record::delta, std::int32_t>;
+    "column/scatter/signed/loop"_bench = scatter_loop<&record::delta, std::int32_t>;
+    "column/scatter/signed/scatter_column"_bench = scatter_column<&record::delta, std::int32_t>;
+};
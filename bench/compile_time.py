@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MPL-2.0
+"""
+Measures the compile time of synthetic register maps, as generated by tools/svd2mmregmap.py,
+with the given number of register fields. Each map is compiled with -fsyntax-only,
+so only the frontend (parsing and template instantiation) is measured.
+"""
+import argparse
+import os
+import pathlib
+import sys
+import tempfile
+
+FIELDS_PER_REGISTER = 16
+REGISTERS_PER_PERIPHERAL = 32
+ACCESSES = ("rw", "rw", "r", "w")
+
+
+def generate_map(field_count, access_every):
+    """Generates a device register map and a function accessing every Nth of its fields."""
+    parts = ["#include <bitfilled.hpp>", ""]
+    accesses = []
+    register_count = (field_count + FIELDS_PER_REGISTER - 1) // FIELDS_PER_REGISTER
+    peripheral_count = (register_count + REGISTERS_PER_PERIPHERAL - 1) // REGISTERS_PER_PERIPHERAL
+    fields = 0
+    for p in range(peripheral_count):
+        parts.append(f"struct PERIPH{p}_t {{")
+        parts.append("    using mmr_ops = ::bitfilled::base;")
+        for r in range(REGISTERS_PER_PERIPHERAL):
+            if fields >= field_count:
+                break
+            reg_access = ACCESSES[(p + r) % len(ACCESSES)]
+            parts.append(
+                f"    struct REG{r}_t : BF_MMREG(std::uint32_t, "
+                f"{reg_access}, mmr_ops) {{\n"
+                f"        BF_COPY_SUPERCLASS(REG{r}_t);"
+            )
+            for f in range(FIELDS_PER_REGISTER):
+                if fields >= field_count:
+                    break
+                # vary the widths, so that the field types differ as in real maps
+                width = 1 + (f + r + p) % 3
+                lsb = (f * 2) % (33 - width)
+                parts.append(
+                    f"        BF_MMREGBITS(std::uint32_t, {reg_access}, "
+                    f"{lsb}, {lsb + width - 1}) F{f};"
+                )
+                if fields % access_every == 0:
+                    if reg_access != "r":
+                        accesses.append(f"    periph{p}.REG{r}.F{f} = value;")
+                    if reg_access != "w":
+                        accesses.append(f"    sum += periph{p}.REG{r}.F{f};")
+                fields += 1
+            parts.append(f"    }} REG{r};")
+        parts.append("};")
+        parts.append(f"extern volatile PERIPH{p}_t periph{p};")
+        parts.append("")
+    parts.append("unsigned access_all(unsigned value)")
+    parts.append("{")
+    parts.append("    unsigned sum = 0;")
+    parts.extend(accesses)
+    parts.append("    return sum;")
+    parts.append("}")
+    return "\n".join(parts) + "\n"
+
+
+def measure(compiler, flags, source, repeat):
+    """Compiles the source, returns the best CPU seconds and the peak memory in MiB."""
+    best_time = None
+    peak_memory = 0
+    for _ in range(repeat):
+        pid = os.spawnvp(os.P_NOWAIT, compiler, [compiler, *flags, "-fsyntax-only", str(source)])
+        _, status, usage = os.wait4(pid, 0)
+        if os.waitstatus_to_exitcode(status) != 0:
+            raise RuntimeError(f"compiling {source} failed")
+        cpu_time = usage.ru_utime + usage.ru_stime
+        best_time = cpu_time if best_time is None else min(best_time, cpu_time)
+        peak_memory = max(peak_memory, usage.ru_maxrss / 1024)
+    return best_time, peak_memory
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--compiler", default="c++", help="the C++ compiler")
+    parser.add_argument("--include", type=pathlib.Path, required=True,
+                        help="the bitfilled include directory")
+    parser.add_argument("--fields", type=int, nargs="+", default=[1000, 10000, 50000],
+                        help="the field counts of the generated maps")
+    parser.add_argument("--access-every", type=int, default=10,
+                        help="access every Nth field, as a device map is only partially used")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="the number of compilations, the fastest one is reported")
+    parser.add_argument("--keep", type=pathlib.Path, help="directory to keep the generated maps in")
+    args = parser.parse_args()
+
+    flags = ["-std=c++20", f"-I{args.include}"]
+    print(f"{'fields':>8} {'CPU time [s]':>14} {'memory [MiB]':>14}")
+    with tempfile.TemporaryDirectory() as tmp:
+        directory = args.keep or pathlib.Path(tmp)
+        directory.mkdir(parents=True, exist_ok=True)
+        for field_count in sorted(args.fields):
+            source = directory / f"map{field_count}.cpp"
+            source.write_text(generate_map(field_count, args.access_every))
+            cpu_time, memory = measure(args.compiler, flags, source, args.repeat)
+            print(f"{field_count:>8} {cpu_time:>14.2f} {memory:>14.0f}", flush=True)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,272 @@
+#include "bench.hpp"
+#include "bitfilled.hpp"
+#include "bitfilled/shadowed_ops.hpp"
+#include "bitfilled/simulated_ops.hpp"
+
+using namespace bench;
+
+namespace
+{
+// the same layout in all representations:
+// bits 0..2: unsigned mode, bits 3..9: signed offset, bits 16..23: 4 * 2 bit set
+struct native_bits
+{
+    std::uint32_t mode : 3;
+    std::int32_t offset : 7;
+    std::uint32_t : 6;
+    std::uint32_t levels : 8;
+};
+
+template <typename TOps = bitfilled::base>
+struct host_reg : bitfilled::host_integer<std::uint32_t, TOps>
+{
+    using superclass = bitfilled::host_integer<std::uint32_t, TOps>;
+    BF_COPY_SUPERCLASS(host_reg);
+    using bf_ops = typename superclass::bf_ops;
+
+    BF_BITS(std::uint8_t, 0, 2) mode;
+    BF_BITS(std::int32_t, 3, 9) offset;
+    BF_BITSET(std::uint8_t, 2, 4, 16) levels BF_BITSET_POSTFIX;
+};
+
+template <std::size_t SIZE>
+struct packed_reg : bitfilled::packed_integer<std::endian::big, SIZE>
+{
+    using superclass = bitfilled::packed_integer<std::endian::big, SIZE>;
+    BF_COPY_SUPERCLASS(packed_reg);
+    using bf_ops = typename superclass::bf_ops;
+
+    BF_BITS(std::uint8_t, 0, 2) mode;
+    BF_BITS(std::int32_t, 3, 9) offset;
+    BF_BITSET(std::uint8_t, 2, 4, 16) levels BF_BITSET_POSTFIX;
+};
+
+struct mm_reg : BF_MMREG(std::uint32_t, rw)
+{
+    BF_COPY_SUPERCLASS(mm_reg)
+
+    BF_MMREGBITS(std::uint8_t, rw, 0, 2) mode;
+    BF_MMREGBITS(std::int32_t, rw, 3, 9) offset;
+    BF_MMREGBITSET(std::uint8_t, rw, 2, 4, 16) levels;
+};
+
+struct mm_reg_shadowed : BF_MMREG(std::uint32_t, w, ::bitfilled::shadowed<struct mm_reg_shadowed>)
+{
+    BF_COPY_SUPERCLASS(mm_reg_shadowed)
+
+    BF_MMREGBITS(std::uint8_t, w, 0, 2) mode;
+    BF_MMREGBITS(std::int32_t, w, 3, 9) offset;
+    BF_MMREGBITSET(std::uint8_t, w, 2, 4, 16) levels;
+};
+
+struct mm_reg_simulated : BF_MMREG(std::uint32_t, rw, ::bitfilled::simulated<>)
+{
+    BF_COPY_SUPERCLASS(mm_reg_simulated)
+
+    BF_MMREGBITS(std::uint8_t, rw, 0, 2) mode;
+    BF_MMREGBITS(std::int32_t, rw, 3, 9) offset;
+    BF_MMREGBITSET(std::uint8_t, rw, 2, 4, 16) levels;
+};
+
+/// @brief  The simulator of the mm_reg_simulated benchmarks, with a model attached to
+///         another register, so that each access looks up the models.
+struct simulation
+{
+    bitfilled::simulator sim{};
+    std::uint32_t other{};
+
+    simulation()
+    {
+        sim.attach(reinterpret_cast<volatile mm_reg_simulated&>(other),
+                   {.read = [](std::uint64_t& stored) { return stored; }});
+    }
+};
+const simulation simulation_instance{};
+
+/// @brief  The storage of the hand-written shift and mask equivalent of the fields.
+struct manual_bits
+{
+    std::uint32_t raw;
+};
+
+template <typename T>
+concept native = std::same_as<std::remove_cv_t<T>, native_bits>;
+template <typename T>
+concept manual = std::same_as<std::remove_cv_t<T>, manual_bits>;
+
+// the field accessors of each representation (plain or volatile)
+
+template <typename T>
+std::uint8_t get_mode(T& obj)
+{
+    if constexpr (manual<T>)
+    {
+        return static_cast<std::uint8_t>(obj.raw & 0x7u);
+    }
+    else
+    {
+        return static_cast<std::uint8_t>(obj.mode);
+    }
+}
+template <typename T>
+void set_mode(T& obj, std::uint8_t value)
+{
+    if constexpr (manual<T>)
+    {
+        obj.raw = (obj.raw & ~0x7u) | (value & 0x7u);
+    }
+    else
+    {
+        obj.mode = value;
+    }
+}
+template <typename T>
+std::int32_t get_offset(T& obj)
+{
+    if constexpr (manual<T>)
+    {
+        return static_cast<std::int32_t>(obj.raw << 22) >> 25;
+    }
+    else
+    {
+        return obj.offset;
+    }
+}
+template <typename T>
+void set_offset(T& obj, std::int32_t value)
+{
+    if constexpr (manual<T>)
+    {
+        obj.raw = (obj.raw & ~0x3f8u) | ((static_cast<std::uint32_t>(value) & 0x7fu) << 3);
+    }
+    else
+    {
+        obj.offset = value;
+    }
+}
+template <typename T>
+std::uint8_t get_level(T& obj, std::size_t index)
+{
+    if constexpr (manual<T>)
+    {
+        return static_cast<std::uint8_t>((obj.raw >> (16 + 2 * index)) & 0x3u);
+    }
+    else if constexpr (native<T>)
+    {
+        return static_cast<std::uint8_t>((obj.levels >> (2 * index)) & 0x3u);
+    }
+    else
+    {
+        return obj.levels[index];
+    }
+}
+template <typename T>
+void set_level(T& obj, std::size_t index, std::uint8_t value)
+{
+    if constexpr (manual<T>)
+    {
+        const auto shift = 16 + 2 * index;
+        obj.raw = (obj.raw & ~(0x3u << shift)) | ((value & 0x3u) << shift);
+    }
+    else if constexpr (native<T>)
+    {
+        const auto shift = 2 * index;
+        obj.levels = (obj.levels & ~(0x3u << shift)) | ((value & 0x3u) << shift);
+    }
+    else
+    {
+        obj.levels[index] = value;
+    }
+}
+
+/// @brief  Runs the access on an object, through a plain or a volatile reference,
+///         depending on TObject's qualification.
+template <typename TObject, typename TAccess>
+void run(std::size_t iterations, TAccess access)
+{
+    static std::remove_cv_t<TObject> storage{};
+    TObject& object = storage;
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        access(object, i);
+        do_not_optimize(storage);
+    }
+}
+
+template <typename TObject>
+void get_unsigned(std::size_t iterations)
+{
+    run<TObject>(iterations, [](auto& obj, std::size_t)
+    {
+        auto value = get_mode(obj);
+        do_not_optimize(value);
+    });
+}
+template <typename TObject>
+void set_unsigned(std::size_t iterations)
+{
+    run<TObject>(iterations,
+                 [](auto& obj, std::size_t i) { set_mode(obj, static_cast<std::uint8_t>(i)); });
+}
+template <typename TObject>
+void get_signed(std::size_t iterations)
+{
+    run<TObject>(iterations, [](auto& obj, std::size_t)
+    {
+        auto value = get_offset(obj);
+        do_not_optimize(value);
+    });
+}
+template <typename TObject>
+void set_signed(std::size_t iterations)
+{
+    run<TObject>(iterations, [](auto& obj, std::size_t i)
+    {
+        set_offset(obj, static_cast<std::int32_t>(i % 128) - 64);
+    });
+}
+template <typename TObject>
+void get_indexed(std::size_t iterations)
+{
+    run<TObject>(iterations, [](auto& obj, std::size_t i)
+    {
+        auto value = get_level(obj, i % 4);
+        do_not_optimize(value);
+    });
+}
+template <typename TObject>
+void set_indexed(std::size_t iterations)
+{
+    run<TObject>(iterations, [](auto& obj, std::size_t i)
+    {
+        set_level(obj, i % 4, static_cast<std::uint8_t>(i));
+    });
+}
+} // namespace
+
+#define FIELD_BENCHES(NAME, TYPE)                                                                  \
+    "fields/get/unsigned/" NAME ""_bench = get_unsigned<TYPE>;                                     \
+    "fields/set/unsigned/" NAME ""_bench = set_unsigned<TYPE>;                                     \
+    "fields/get/signed/" NAME ""_bench = get_signed<TYPE>;                                         \
+    "fields/set/signed/" NAME ""_bench = set_signed<TYPE>;                                         \
+    "fields/get/indexed/" NAME ""_bench = get_indexed<TYPE>;                                       \
+    "fields/set/indexed/" NAME ""_bench = set_indexed<TYPE>
+
+const suite fields = []
+{
+    FIELD_BENCHES("native", native_bits);
+    FIELD_BENCHES("native/volatile", volatile native_bits);
+    FIELD_BENCHES("manual", manual_bits);
+    FIELD_BENCHES("manual/volatile", volatile manual_bits);
+    FIELD_BENCHES("host_integer", host_reg<>);
+    FIELD_BENCHES("host_integer/shadowed", host_reg<bitfilled::shadowed<struct host_reg_shadow>>);
+    FIELD_BENCHES("packed_integer<3>", packed_reg<3>);
+    FIELD_BENCHES("packed_integer<4>", packed_reg<4>);
+    FIELD_BENCHES("packed_integer<5>", packed_reg<5>);
+    FIELD_BENCHES("mmreg", mm_reg);
+    FIELD_BENCHES("mmreg/volatile", volatile mm_reg);
+    FIELD_BENCHES("mmreg/volatile/simulated", volatile mm_reg_simulated);
+    "fields/set/unsigned/mmreg/volatile/shadowed"_bench = set_unsigned<volatile mm_reg_shadowed>;
+    "fields/set/signed/mmreg/volatile/shadowed"_bench = set_signed<volatile mm_reg_shadowed>;
+    "fields/set/indexed/mmreg/volatile/shadowed"_bench = set_indexed<volatile mm_reg_shadowed>;
+};
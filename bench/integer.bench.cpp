@@ -0,0 +1,106 @@
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include "bench.hpp"
+#include "bitfilled/integer.hpp"
+
+using namespace bench;
+
+namespace
+{
+constexpr std::size_t SAMPLES = 1 << 14;
+
+template <std::size_t SIZE>
+using sample_value = std::conditional_t<(SIZE > 4), std::int64_t, std::int32_t>;
+
+template <std::size_t SIZE>
+using sample = bitfilled::packed_integer<std::endian::big, SIZE, sample_value<SIZE>>;
+
+template <std::size_t SIZE>
+const std::vector<sample<SIZE>>& samples()
+{
+    static const auto values = []
+    {
+        std::vector<sample<SIZE>> v(SAMPLES);
+        std::uint64_t x = 12345;
+        for (auto& s : v)
+        {
+            x = x * 6364136223846793005u + 1442695040888963407u;
+            s = static_cast<sample_value<SIZE>>(static_cast<std::int64_t>(x) >> ((8 - SIZE) * 8));
+        }
+        return v;
+    }();
+    return values;
+}
+
+template <std::size_t SIZE>
+void convert_loop(std::size_t iterations)
+{
+    const auto& in = samples<SIZE>();
+    std::vector<sample_value<SIZE>> out(in.size());
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        for (std::size_t j = 0; j < in.size(); ++j)
+        {
+            out[j] = in[j];
+        }
+        do_not_optimize(out);
+    }
+}
+
+template <std::size_t SIZE>
+void convert_to_native(std::size_t iterations)
+{
+    const auto& in = samples<SIZE>();
+    std::vector<sample_value<SIZE>> out(in.size());
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bitfilled::to_native(std::span{in}, std::span{out});
+        do_not_optimize(out);
+    }
+}
+
+template <std::size_t SIZE>
+void convert_from_native(std::size_t iterations)
+{
+    std::vector<sample_value<SIZE>> in(SAMPLES, -12345);
+    std::vector<sample<SIZE>> out(in.size());
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        bitfilled::from_native(std::span{in}, std::span{out});
+        do_not_optimize(out);
+    }
+}
+
+template <std::size_t SIZE>
+void copy_memcpy(std::size_t iterations)
+{
+    const auto& in = samples<SIZE>();
+    std::vector<sample_value<SIZE>> out(in.size());
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        std::memcpy(out.data(), in.data(), in.size() * sizeof(in[0]));
+        do_not_optimize(out);
+    }
+}
+} // namespace
+
+const suite integer = []
+{
+    "packed/3/loop"_bench = convert_loop<3>;
+    "packed/3/to_native"_bench = convert_to_native<3>;
+    "packed/3/from_native"_bench = convert_from_native<3>;
+    "packed/3/memcpy"_bench = copy_memcpy<3>;
+    "packed/4/loop"_bench = convert_loop<4>;
+    "packed/4/to_native"_bench = convert_to_native<4>;
+    "packed/4/from_native"_bench = convert_from_native<4>;
+    "packed/4/memcpy"_bench = copy_memcpy<4>;
+    "packed/5/loop"_bench = convert_loop<5>;
+    "packed/5/to_native"_bench = convert_to_native<5>;
+    "packed/5/from_native"_bench = convert_from_native<5>;
+    "packed/5/memcpy"_bench = copy_memcpy<5>;
+    "packed/6/loop"_bench = convert_loop<6>;
+    "packed/6/to_native"_bench = convert_to_native<6>;
+    "packed/6/from_native"_bench = convert_from_native<6>;
+    "packed/6/memcpy"_bench = copy_memcpy<6>;
+};
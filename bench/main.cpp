@@ -0,0 +1,6 @@
+#include "bench.hpp"
+
+int main(int argc, char** argv)
+{
+    return bench::run_all(argc > 1 ? argv[1] : "");
+}
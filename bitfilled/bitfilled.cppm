@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MPL-2.0
+// The bitfilled module, which exports the core field, integer and register types,
+// and depends on freestanding-friendly standard headers only, for firmware use.
+// The other headers are provided by the bitfilled.extensions and bitfilled.host modules.
+// The macros (BF_BITS, BF_MMREG, ...) cannot be exported by a module,
+// include "bitfilled/macros.hpp" next to the import to use them.
+module;
+
+#include "bitfilled/access.hpp"
+#include "bitfilled/base_ops.hpp"
+#include "bitfilled/bitband_ops.hpp"
+#include "bitfilled/bits.hpp"
+#include "bitfilled/integer.hpp"
+#include "bitfilled/mmreg.hpp"
+
+export module bitfilled;
+
+export namespace bitfilled
+{
+// access.hpp
+using bitfilled::access;
+using bitfilled::operator&;
+using bitfilled::operator|;
+using bitfilled::DefinesAccess;
+using bitfilled::is_ephemeralwrite;
+using bitfilled::is_readable;
+using bitfilled::is_readonly;
+using bitfilled::is_readwrite;
+using bitfilled::is_writeable;
+using bitfilled::is_writeonly;
+
+// size.hpp
+using bitfilled::aligned_size;
+using bitfilled::byte_width;
+
+// integer.hpp
+using bitfilled::bytewise;
+using bitfilled::from_native;
+using bitfilled::host_integer;
+using bitfilled::integer_storage;
+using bitfilled::Integral;
+using bitfilled::packed_integer;
+using bitfilled::sized_integer;
+using bitfilled::sized_signed_t;
+using bitfilled::sized_unsigned_t;
+using bitfilled::to_native;
+
+// base_ops.hpp
+using bitfilled::base;
+using bitfilled::bitfield_props;
+using bitfilled::copy_cv_reference;
+using bitfilled::copy_cv_t;
+using bitfilled::owner_cast;
+using bitfilled::regbitfieldset_props;
+using bitfilled::write_traits;
+
+// bitband_ops.hpp
+using bitfilled::bitband;
+
+// bits.hpp
+using bitfilled::bitfield;
+using bitfilled::bitfieldset;
+using bitfilled::empty_type;
+using bitfilled::regbitfield;
+using bitfilled::regbitfield_reference;
+using bitfilled::regbitfieldset;
+using bitfilled::regbitfieldset_iterator;
+
+// mmreg.hpp
+using bitfilled::mmreg;
+} // namespace bitfilled
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MPL-2.0
+// The bitfilled.extensions module, which exports the transactions, the additional ops policies
+// and containers, and the bitfilled module. These don't need an operating system either.
+// The macros (BF_BITS, BF_MMREG, ...) cannot be exported by a module,
+// include "bitfilled/macros.hpp" next to the import to use them.
+module;
+
+#include "bitfilled/atomic_ops.hpp"
+#include "bitfilled/bitarray.hpp"
+#include "bitfilled/bitstream.hpp"
+#include "bitfilled/column.hpp"
+#include "bitfilled/record.hpp"
+#include "bitfilled/setclr_alias_ops.hpp"
+#include "bitfilled/shadowed_ops.hpp"
+#include "bitfilled/transaction.hpp"
+#include "bitfilled/view.hpp"
+
+export module bitfilled.extensions;
+
+export import bitfilled;
+
+export namespace bitfilled
+{
+// atomic_ops.hpp
+using bitfilled::atomic;
+using bitfilled::notify_all;
+using bitfilled::notify_one;
+using bitfilled::wait;
+
+// setclr_alias_ops.hpp, shadowed_ops.hpp
+using bitfilled::setclr_alias;
+using bitfilled::toggle;
+using bitfilled::shadowed;
+
+// bitstream.hpp
+using bitfilled::bit_order;
+using bitfilled::bit_reader;
+using bitfilled::bit_writer;
+using bitfilled::BitLayout;
+
+// record.hpp
+using bitfilled::packed_record;
+
+// bitarray.hpp
+using bitfilled::host_bitarray;
+
+// transaction.hpp
+using bitfilled::build;
+using bitfilled::extract;
+using bitfilled::field;
+using bitfilled::field_assignment;
+using bitfilled::field_ref;
+using bitfilled::all_clear;
+using bitfilled::any_set;
+using bitfilled::field_matcher;
+using bitfilled::match;
+using bitfilled::matching;
+using bitfilled::modify;
+using bitfilled::read;
+using bitfilled::register_image;
+using bitfilled::register_init;
+using bitfilled::register_value;
+
+// column.hpp
+using bitfilled::extract_column;
+using bitfilled::scatter_column;
+
+// view.hpp
+using bitfilled::packed_ref;
+using bitfilled::packed_view;
+} // namespace bitfilled
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MPL-2.0
+// The bitfilled.host module, which exports the ops policies and devices of host programs
+// (tracing, simulation, binary logging, remote and asynchronous register access),
+// and the bitfilled.extensions module. These need threads, the C stdio and dynamic allocation.
+// The macros (BF_BITS, BF_MMREG, BF_LAYOUT, ...) cannot be exported by a module,
+// include "bitfilled/macros.hpp" next to the import to use them.
+module;
+
+#include "bitfilled/async.hpp"
+#include "bitfilled/binlog.hpp"
+#include "bitfilled/remote.hpp"
+#include "bitfilled/simulated_ops.hpp"
+#include "bitfilled/traced_ops.hpp"
+
+export module bitfilled.host;
+
+export import bitfilled.extensions;
+
+export namespace bitfilled
+{
+// simulated_ops.hpp, traced_ops.hpp
+using bitfilled::simulated;
+using bitfilled::simulator;
+using bitfilled::trace_kind;
+using bitfilled::trace_record;
+using bitfilled::trace_ring;
+using bitfilled::traced;
+
+// binlog.hpp
+using bitfilled::binlog;
+using bitfilled::field_info;
+using bitfilled::field_kind;
+using bitfilled::layout_id;
+using bitfilled::layout_info;
+using bitfilled::log_snapshot;
+using bitfilled::LoggableLayout;
+using bitfilled::make_field_info;
+using bitfilled::write_layouts;
+
+// remote.hpp
+using bitfilled::loopback_transport;
+using bitfilled::register_transport;
+using bitfilled::remote_batch;
+using bitfilled::remote_device;
+using bitfilled::remote_reg;
+
+// async.hpp
+using bitfilled::async_device;
+using bitfilled::async_executor;
+using bitfilled::async_modify;
+using bitfilled::async_read;
+using bitfilled::async_reg;
+using bitfilled::async_register_transport;
+using bitfilled::async_request;
+using bitfilled::async_task;
+using bitfilled::async_write;
+using bitfilled::AsyncField;
+using bitfilled::AsyncRegister;
+using bitfilled::latency_transport;
+} // namespace bitfilled
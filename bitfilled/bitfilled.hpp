@@ -2,3 +2,4 @@
 #include "bitfilled/bits.hpp"
 #include "bitfilled/macros.hpp"
 #include "bitfilled/mmreg.hpp"
+#include "bitfilled/transaction.hpp"
@@ -0,0 +1,515 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <optional>
+#include <queue>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "bitfilled/remote.hpp"
+#include "bitfilled/transaction.hpp"
+
+namespace bitfilled
+{
+/// @brief  A register transaction in flight on an @ref async_register_transport.
+struct async_request
+{
+    bool write;
+    std::uint32_t address;
+    std::span<std::byte> data;
+    /// the result of the transaction, set by the transport before resuming the continuation
+    std::error_code error{};
+    /// the coroutine awaiting the completion of the transaction
+    std::coroutine_handle<> continuation{};
+};
+
+/// @brief  The async_register_transport class is the interface of a slow bus,
+///         which carries the register accesses of an @ref async_device without blocking.
+///         The transport may keep any number of requests in flight (pipelining them),
+///         and completes each one by setting its error and resuming its continuation
+///         from the executor's thread (e.g. with @ref async_executor::post()),
+///         never from within submit().
+class async_register_transport
+{
+  public:
+    virtual ~async_register_transport() = default;
+
+    /// @brief  Starts the transaction, the request stays valid until it is completed.
+    virtual void submit(async_request& request) = 0;
+};
+
+/// @brief  The async_task class is a lazily started coroutine, which produces a value of type T.
+///         It is awaited by another coroutine, or started on an @ref async_executor.
+///         Exceptions are not propagated across the awaits (as on -fno-exceptions targets),
+///         an exception leaving the coroutine terminates the program.
+/// @tparam T: the result type of the coroutine
+template <typename T = void>
+class [[nodiscard]] async_task
+{
+    struct promise_base
+    {
+        std::coroutine_handle<> continuation = std::noop_coroutine();
+
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+    struct value_promise : promise_base
+    {
+        std::optional<T> value{};
+
+        void return_value(T v) { value.emplace(std::move(v)); }
+    };
+    struct void_promise : promise_base
+    {
+        void return_void() {}
+    };
+
+  public:
+    struct promise_type : std::conditional_t<std::is_void_v<T>, void_promise, value_promise>
+    {
+        async_task get_return_object()
+        {
+            return async_task{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        auto final_suspend() noexcept
+        {
+            // resumes the awaiting coroutine, if there is any
+            struct final_awaiter
+            {
+                bool await_ready() noexcept { return false; }
+                std::coroutine_handle<>
+                await_suspend(std::coroutine_handle<promise_type> handle) noexcept
+                {
+                    return handle.promise().continuation;
+                }
+                void await_resume() noexcept {}
+            };
+            return final_awaiter{};
+        }
+    };
+
+    async_task(async_task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+    async_task& operator=(async_task&& other) noexcept
+    {
+        std::swap(handle_, other.handle_);
+        return *this;
+    }
+    ~async_task()
+    {
+        if (handle_)
+        {
+            handle_.destroy();
+        }
+    }
+
+    /// @brief  Whether the coroutine has run to completion.
+    bool done() const { return handle_.done(); }
+    /// @brief  The result of the completed coroutine.
+    T result()
+    {
+        if constexpr (!std::is_void_v<T>)
+        {
+            return std::move(*handle_.promise().value);
+        }
+    }
+    /// @brief  The coroutine, which the executor starts (once).
+    std::coroutine_handle<> handle() const { return handle_; }
+
+    auto operator co_await() && noexcept
+    {
+        struct awaiter
+        {
+            std::coroutine_handle<promise_type> handle;
+
+            bool await_ready() noexcept { return handle.done(); }
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+            {
+                handle.promise().continuation = continuation;
+                return handle;
+            }
+            T await_resume()
+            {
+                if constexpr (!std::is_void_v<T>)
+                {
+                    return std::move(*handle.promise().value);
+                }
+            }
+        };
+        return awaiter{handle_};
+    }
+
+  private:
+    explicit async_task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+/// @brief  The async_executor class is a single-threaded executor of coroutines:
+///         it resumes the posted coroutines in order, and the timed ones when their time comes,
+///         sleeping while there is nothing else to run.
+///         All its functions must be called from the same thread.
+class async_executor
+{
+  public:
+    using clock = std::chrono::steady_clock;
+
+    /// @brief  Queues the coroutine to be resumed.
+    void post(std::coroutine_handle<> handle) { ready_.push_back(handle); }
+    /// @brief  Queues the coroutine to be resumed at the given time
+    ///         (coroutines due at the same time are resumed in the order of posting).
+    void post_at(clock::time_point when, std::coroutine_handle<> handle)
+    {
+        timers_.push(timer{when, sequence_++, handle});
+    }
+    /// @brief  Queues the task to be started. The task must outlive its execution.
+    template <typename T>
+    void start(async_task<T>& task)
+    {
+        post(task.handle());
+    }
+
+    /// @brief  Whether there are no coroutines waiting to be resumed.
+    bool idle() const { return ready_.empty() and timers_.empty(); }
+
+    /// @brief  Resumes the coroutines until none is waiting.
+    /// @return the number of resumptions
+    std::size_t run()
+    {
+        std::size_t resumed = 0;
+        for (;;)
+        {
+            while (!ready_.empty())
+            {
+                const auto handle = ready_.front();
+                ready_.pop_front();
+                handle.resume();
+                ++resumed;
+            }
+            if (timers_.empty())
+            {
+                return resumed;
+            }
+            std::this_thread::sleep_until(timers_.top().when);
+            const auto now = clock::now();
+            while (!timers_.empty() and (timers_.top().when <= now))
+            {
+                ready_.push_back(timers_.top().handle);
+                timers_.pop();
+            }
+        }
+    }
+
+  private:
+    struct timer
+    {
+        clock::time_point when;
+        std::uint64_t sequence;
+        std::coroutine_handle<> handle;
+
+        friend bool operator>(const timer& a, const timer& b)
+        {
+            return (a.when != b.when) ? (a.when > b.when) : (a.sequence > b.sequence);
+        }
+    };
+
+    std::deque<std::coroutine_handle<>> ready_{};
+    std::priority_queue<timer, std::vector<timer>, std::greater<>> timers_{};
+    std::uint64_t sequence_{};
+};
+
+namespace detail
+{
+/// @brief  The async_bus class is the common part of the @ref async_device types,
+///         which the registers find at their own address.
+class async_bus
+{
+  public:
+    async_bus(async_register_transport& transport, std::endian endianness)
+        : transport_(&transport), endianness_(endianness)
+    {}
+    async_bus(const async_bus&) = delete;
+    async_bus& operator=(const async_bus&) = delete;
+
+    /// @brief  Whether all bus transactions succeeded since the last clear_error().
+    explicit operator bool() const { return !error_; }
+    /// @brief  The error of the last failed bus transaction.
+    std::error_code error() const { return error_; }
+    void clear_error() { error_ = {}; }
+    /// @brief  The byte order of the multi-byte registers on the bus.
+    std::endian endianness() const { return endianness_; }
+    async_register_transport& transport() const { return *transport_; }
+
+    /// @brief  The bus of the register, which is located at the address of its device.
+    static async_bus& of(const void* reg)
+    {
+        return *const_cast<async_bus*>(static_cast<const async_bus*>(reg));
+    }
+
+    void record(std::error_code error)
+    {
+        if (error)
+        {
+            error_ = error;
+        }
+    }
+
+  private:
+    async_register_transport* transport_;
+    std::endian endianness_;
+    std::error_code error_{};
+};
+
+/// @brief  The awaiter of a single register transaction, which keeps the request and the
+///         register bytes in the awaiting coroutine's frame.
+/// @tparam TInt: the register's integral type
+/// @tparam TResult: the awaited result: void for a write, TInt or a field type for a read
+template <typename TInt, typename TResult>
+class async_transfer
+{
+  public:
+    /// @brief  Reads the register.
+    async_transfer(async_bus& bus, std::uint32_t address) : bus_(&bus), address_(address) {}
+    /// @brief  Writes the register.
+    async_transfer(async_bus& bus, std::uint32_t address, TInt value)
+        : bus_(&bus), address_(address), bytes_(value, bus.endianness())
+    {}
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(std::coroutine_handle<> continuation)
+    {
+        request_ = async_request{std::is_void_v<TResult>, address_,
+                                 std::as_writable_bytes(std::span{bytes_}), {}, continuation};
+        bus_->transport().submit(request_);
+    }
+    auto await_resume()
+    {
+        bus_->record(request_.error);
+        if constexpr (!std::is_void_v<TResult>)
+        {
+            const auto value = request_.error ? TInt{}
+                                              : bytes_.template to_integral<TInt>(
+                                                    bus_->endianness());
+            if constexpr (std::is_same_v<TResult, TInt>)
+            {
+                return value;
+            }
+            else
+            {
+                return extract<TResult>(value);
+            }
+        }
+    }
+
+    /// @brief  The result of the completed transaction.
+    std::error_code error() const { return request_.error; }
+
+  private:
+    async_bus* bus_;
+    std::uint32_t address_;
+    integer_storage<sizeof(TInt)> bytes_{};
+    async_request request_{};
+};
+} // namespace detail
+
+/// @brief  async_device is the base of the register map of a device behind a slow bus
+///         (a struct of @ref async_reg members), which binds the registers to the transport.
+///         The registers are empty objects, which find the transport at the address
+///         of the device, therefore they must be declared [[no_unique_address]].
+/// @tparam TDevice: the register map type (CRTP)
+template <typename TDevice>
+struct async_device : public detail::async_bus
+{
+    /// @param  transport: the asynchronous bus transport to the device
+    /// @param  endianness: the byte order of the multi-byte registers on the bus
+    explicit async_device(async_register_transport& transport,
+                          std::endian endianness = std::endian::big)
+        : async_bus(transport, endianness)
+    {
+        static_assert(sizeof(TDevice) == sizeof(detail::async_bus),
+                      "the registers must be [[no_unique_address]] members of distinct types");
+    }
+};
+
+/// @brief  async_reg represents a register of a device behind a slow bus (@ref async_device).
+///         It has no blocking accessors: the register and its fields are accessed with
+///         the awaitable @ref async_read, @ref async_write and @ref async_modify functions.
+/// @tparam T: the register's integral type
+/// @tparam ACCESS: the access type of the register
+/// @tparam ADDRESS: the register's address on the device
+template <Integral T, enum access ACCESS, std::uint32_t ADDRESS>
+struct async_reg
+{
+    using superclass = async_reg;
+    using value_type = T;
+    using bf_ops = base::bitfield_ops<async_reg, ACCESS>;
+
+    static constexpr enum access access() { return ACCESS; }
+    static constexpr std::uint32_t address() { return ADDRESS; }
+    constexpr static auto size() { return sizeof(T); }
+
+    async_reg() = default;
+    ~async_reg() = default;
+    async_reg(const async_reg&) = delete;
+    async_reg& operator=(const async_reg&) = delete;
+};
+
+namespace detail
+{
+template <typename T>
+struct is_async_reg : std::false_type
+{};
+template <typename T, enum access ACCESS, std::uint32_t ADDRESS>
+struct is_async_reg<async_reg<T, ACCESS, ADDRESS>> : std::true_type
+{};
+
+/// @brief  The register which the bitfield operations belong to.
+template <typename TOps>
+struct async_field_owner
+{};
+template <typename T, enum access ACCESS, std::uint32_t ADDRESS, enum access FIELD_ACCESS>
+struct async_field_owner<base::bitfield_ops<async_reg<T, ACCESS, ADDRESS>, FIELD_ACCESS>>
+{
+    using type = async_reg<T, ACCESS, ADDRESS>;
+};
+} // namespace detail
+
+/// @brief  A register type of an @ref async_device.
+template <typename T>
+concept AsyncRegister =
+    requires { typename T::superclass; } and detail::is_async_reg<typename T::superclass>::value;
+
+/// @brief  A bitfield of an @ref async_reg.
+template <typename T>
+concept AsyncField = requires { typename detail::async_field_owner<typename T::ops_type>::type; } and
+                     !T::dynamic_index;
+
+/// @brief  Reads the register's value with a single bus transaction.
+/// @return the awaitable of the value (zero, if the transaction failed)
+template <AsyncRegister TReg>
+auto async_read(const TReg& reg)
+    requires(is_readable<TReg::access()>)
+{
+    using int_type = typename TReg::value_type;
+    return detail::async_transfer<int_type, int_type>{detail::async_bus::of(&reg),
+                                                      TReg::address()};
+}
+
+/// @brief  Reads the field of a register with a single bus transaction.
+/// @return the awaitable of the field value (zero, if the transaction failed)
+template <AsyncField TField>
+auto async_read(const TField& field)
+    requires(is_readable<TField::access()>)
+{
+    using reg_type = typename detail::async_field_owner<typename TField::ops_type>::type;
+    return detail::async_transfer<typename reg_type::value_type, TField>{
+        detail::async_bus::of(&field), reg_type::address()};
+}
+
+/// @brief  Writes the register's value with a single bus transaction.
+/// @return the awaitable of the completion
+template <AsyncRegister TReg>
+auto async_write(TReg& reg, typename TReg::value_type value)
+    requires(is_writeable<TReg::access()>)
+{
+    return detail::async_transfer<typename TReg::value_type, void>{detail::async_bus::of(&reg),
+                                                                   TReg::address(), value};
+}
+
+/// @brief  Writes multiple fields of the register with a read-modify-write cycle of two
+///         bus transactions (or a single write, when the register cannot be read back).
+///         The register isn't written if it couldn't be read.
+/// @param  reg: the register of an @ref async_device
+/// @param  assignments: the field assignments, created with @ref field
+/// @return the task of the cycle
+template <AsyncRegister TReg, typename... TFields, typename... TClasses>
+async_task<> async_modify(TReg& reg, field_assignment<TFields, TClasses>... assignments)
+{
+    using int_type = typename TReg::value_type;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the modified register");
+    static_assert((is_writeable<TFields::access()> and ...), "the fields must be writeable");
+
+    auto& bus = detail::async_bus::of(&reg);
+    constexpr auto mask = detail::fields_mask<int_type, TFields...>();
+    auto value = static_cast<int_type>((int_type{} | ... |
+                                        assignments.template positioned<int_type>()) &
+                                       mask);
+    if constexpr (is_readable<TReg::access()> and !is_ephemeralwrite<TReg::access()>)
+    {
+        detail::async_transfer<int_type, int_type> current{bus, TReg::address()};
+        const auto current_value = co_await current;
+        if (current.error())
+        {
+            co_return;
+        }
+        value = static_cast<int_type>((current_value & ~mask) | value);
+    }
+    co_await detail::async_transfer<int_type, void>{bus, TReg::address(), value};
+}
+
+/// @brief  The latency_transport class is an @ref async_register_transport for tests and
+///         benchmarks, which carries the requests to a blocking @ref register_transport
+///         (e.g. a @ref loopback_transport) and completes them after the given latency.
+///         At most `depth` requests are pipelined, the following ones wait for a free slot,
+///         and the requests complete in the order of submission.
+class latency_transport : public async_register_transport
+{
+  public:
+    using clock = async_executor::clock;
+
+    /// @param  target: the transport which executes the requests, when they are submitted
+    /// @param  executor: the executor resuming the completed requests' coroutines
+    /// @param  latency: the time from the start of a request to its completion
+    /// @param  depth: the number of requests the bus carries at once
+    latency_transport(register_transport& target, async_executor& executor,
+                      clock::duration latency, std::size_t depth = 1)
+        : target_(target), executor_(executor), latency_(latency), depth_(depth)
+    {}
+
+    void submit(async_request& request) override
+    {
+        const auto now = clock::now();
+        while (!completions_.empty() and (completions_.front() <= now))
+        {
+            completions_.pop_front();
+        }
+        // the request starts when the depth-th previous one completes
+        auto start = now;
+        if (completions_.size() >= depth_)
+        {
+            start = std::max(start, completions_[completions_.size() - depth_]);
+        }
+        auto completion = start + latency_;
+        if (!completions_.empty())
+        {
+            completion = std::max(completion, completions_.back());
+        }
+        completions_.push_back(completion);
+        max_outstanding_ = std::max(max_outstanding_, completions_.size());
+
+        request.error = request.write ? target_.write(request.address, request.data)
+                                      : target_.read(request.address, request.data);
+        executor_.post_at(completion, request.continuation);
+    }
+
+    /// @brief  The highest number of requests submitted and not yet completed at once.
+    std::size_t max_outstanding() const { return max_outstanding_; }
+
+  private:
+    register_transport& target_;
+    async_executor& executor_;
+    clock::duration latency_;
+    std::size_t depth_;
+    std::deque<clock::time_point> completions_{};
+    std::size_t max_outstanding_{};
+};
+
+} // namespace bitfilled
@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <atomic>
+#include "bitfilled/transaction.hpp"
+
+namespace bitfilled
+{
+namespace detail
+{
+/// @brief  The strongest memory order of a load, which the given order permits.
+constexpr std::memory_order load_order(std::memory_order order)
+{
+    switch (order)
+    {
+    case std::memory_order_release:
+        return std::memory_order_relaxed;
+    case std::memory_order_acq_rel:
+        return std::memory_order_acquire;
+    default:
+        return order;
+    }
+}
+/// @brief  The strongest memory order of a store, which the given order permits.
+constexpr std::memory_order store_order(std::memory_order order)
+{
+    switch (order)
+    {
+    case std::memory_order_consume:
+    case std::memory_order_acquire:
+        return std::memory_order_relaxed;
+    case std::memory_order_acq_rel:
+        return std::memory_order_release;
+    default:
+        return order;
+    }
+}
+} // namespace detail
+
+/// @tparam ORDER: the memory order of the operations (restricted to the valid orders
+///         of loads and stores)
+template <std::memory_order ORDER = std::memory_order_seq_cst>
+struct atomic
+{
+    /// @brief  These bitfield operations access the owner through std::atomic_ref,
+    ///         so that the fields of a shared word can be modified concurrently without locks:
+    ///         single bits are set and cleared with fetch_or / fetch_and,
+    ///         wider fields (and @ref modify transactions) with a compare-exchange loop.
+    /// @note   These operations shall only be used on non-volatile @ref host_integer types.
+    /// @tparam T
+    /// @tparam ACCESS
+    template <typename T, enum access ACCESS = access::readwrite>
+    struct bitfield_ops
+    {
+        using int_type = typename T::value_type;
+        static constexpr enum access access() { return ACCESS; }
+
+      private:
+        using atomic_type = std::atomic_ref<int_type>;
+        static_assert(!is_ephemeralwrite<ACCESS>, "ephemeral writes cannot be atomic");
+        static_assert(alignof(T) >= atomic_type::required_alignment,
+                      "the owner must be aligned for atomic access");
+
+        template <typename Tptr>
+        static atomic_type ref(const Tptr& ptr)
+        {
+            // std::atomic_ref requires a non-const reference, even for loads
+            auto& owner = const_cast<T&>(owner_cast<T>(ptr));
+            return atomic_type(static_cast<int_type&>(owner));
+        }
+
+        /// @brief  Replaces the masked bits with a single atomic operation.
+        template <typename Tptr>
+        static void update(Tptr& ptr, int_type mask, int_type value)
+        {
+            value = static_cast<int_type>(value & mask);
+            auto word = ref(ptr);
+            if (value == mask)
+            {
+                word.fetch_or(mask, ORDER);
+            }
+            else if (value == 0)
+            {
+                word.fetch_and(static_cast<int_type>(~mask), ORDER);
+            }
+            else
+            {
+                auto expected = word.load(std::memory_order_relaxed);
+                while (!word.compare_exchange_weak(
+                    expected, static_cast<int_type>((expected & ~mask) | value), ORDER,
+                    detail::load_order(ORDER)))
+                {
+                }
+            }
+        }
+
+      public:
+        /// @brief  Reads the whole value of the owner with the given memory order.
+        template <typename Tptr>
+        static int_type get_value(const Tptr& ptr,
+                                  std::memory_order order = detail::load_order(ORDER))
+            requires(is_readable<ACCESS>)
+        {
+            return ref(ptr).load(order);
+        }
+        template <typename Tptr>
+        static void set_value(Tptr& ptr, int_type value)
+            requires(is_writeable<ACCESS>)
+        {
+            ref(ptr).store(value, detail::store_order(ORDER));
+        }
+        template <typename Tptr>
+        static void modify_value(Tptr& ptr, int_type mask, int_type value)
+            requires(is_writeable<ACCESS>)
+        {
+            update(ptr, mask, value);
+        }
+
+        /// @brief  Blocks until the whole value of the owner differs from the old value.
+        template <typename Tptr>
+        static void wait_value(const Tptr& ptr, int_type old,
+                               std::memory_order order = detail::load_order(ORDER))
+            requires(is_readable<ACCESS>)
+        {
+            ref(ptr).wait(old, order);
+        }
+        template <typename Tptr>
+        static void notify_one(Tptr& ptr)
+        {
+            ref(ptr).notify_one();
+        }
+        template <typename Tptr>
+        static void notify_all(Tptr& ptr)
+        {
+            ref(ptr).notify_all();
+        }
+
+        template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+        static void set_field(bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            using props = bitfield_props<FIRST_BIT, LAST_BIT>;
+            update(bf, static_cast<int_type>(props::template mask<int_type>() << FIRST_BIT),
+                   props::position_field(static_cast<int_type>(value)));
+        }
+        template <typename TVal, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+        static TVal get_field(const bitfield_props<FIRST_BIT, LAST_BIT>& bf)
+            requires(is_readable<ACCESS>)
+        {
+            using props = bitfield_props<FIRST_BIT, LAST_BIT>;
+            auto typeval = static_cast<TVal>(props::extract_field(get_value(bf)));
+            return props::sign_extend(typeval);
+        }
+
+        template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+        static void set_item(regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+            update(bf,
+                   static_cast<int_type>(props::template mask<int_type>() << props::offset(index)),
+                   props::position_field(static_cast<int_type>(value), index));
+        }
+        template <typename TVal, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+        static TVal get_item(const regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index)
+            requires(is_readable<ACCESS>)
+        {
+            using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+            auto typeval = static_cast<TVal>(props::extract_field(get_value(bf), index));
+            return props::sign_extend(typeval);
+        }
+    };
+};
+
+/// @brief  Reads multiple fields of an owner with @ref atomic operations in a single load,
+///         with the given memory order.
+/// @param  reg: the owner object
+/// @param  order: the memory order of the load
+/// @param  members: the bitfield member pointers
+/// @return a tuple of the field values, in the order of the arguments
+template <typename TReg, typename... TClasses, typename... TFields>
+std::tuple<typename TFields::value_type...> read(const TReg& reg, std::memory_order order,
+                                                 [[maybe_unused]] TFields TClasses::*... members)
+{
+    using ops_type = typename std::remove_cv_t<TReg>::bf_ops;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the read object");
+    static_assert((is_readable<TFields::access()> and ...), "the fields must be readable");
+
+    const auto value = ops_type::get_value(reg, order);
+    return {extract<TFields>(value)...};
+}
+
+/// @brief  Blocks until the field of an owner with @ref atomic operations differs
+///         from the old value. The writers have to call @ref notify_all (or notify_one)
+///         on the owner after the change.
+/// @tparam MEMBER: the bitfield member pointer
+/// @param  reg: the owner object
+/// @param  old: the field value to wait out
+/// @param  order: the memory order of the loads
+/// @return the new value of the field
+template <auto MEMBER, typename TReg>
+typename field_ref<MEMBER>::value_type wait(const TReg& reg,
+                                            typename field_ref<MEMBER>::value_type old,
+                                            std::memory_order order = std::memory_order_seq_cst)
+{
+    using ops_type = typename std::remove_cv_t<TReg>::bf_ops;
+    using field_type = typename field_ref<MEMBER>::field_type;
+    static_assert(detail::members_of<TReg, typename field_ref<MEMBER>::class_type>,
+                  "the field must be a member of the waited object");
+
+    for (auto value = ops_type::get_value(reg, order);; value = ops_type::get_value(reg, order))
+    {
+        const auto field_value = extract<field_type>(value);
+        if (field_value != old)
+        {
+            return field_value;
+        }
+        // the other fields may change as well, which merely causes another round
+        ops_type::wait_value(reg, value, order);
+    }
+}
+
+/// @brief  Wakes up a thread waiting on a field of the owner.
+template <typename TReg>
+void notify_one(TReg& reg)
+{
+    std::remove_cv_t<TReg>::bf_ops::notify_one(reg);
+}
+/// @brief  Wakes up all threads waiting on a field of the owner.
+template <typename TReg>
+void notify_all(TReg& reg)
+{
+    std::remove_cv_t<TReg>::bf_ops::notify_all(reg);
+}
+
+} // namespace bitfilled
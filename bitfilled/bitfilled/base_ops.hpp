@@ -45,6 +45,23 @@ struct copy_cv_reference
 template <typename From, typename To>
 using copy_cv_t = typename copy_cv_reference<From, To>::type;
 
+/// @brief  Access the owner object through a reference to itself, or to one of its bitfield
+///         members (which share the owner's address).
+template <typename T, typename Tptr>
+constexpr copy_cv_t<Tptr&, T> owner_cast(Tptr& ptr)
+{
+    if constexpr (std::is_base_of_v<T, std::remove_cv_t<Tptr>>)
+    {
+        return ptr;
+    }
+    else
+    {
+        // the bitfield props are empty members, and carry no alignment requirement
+        return *static_cast<std::remove_reference_t<copy_cv_t<Tptr&, T>>*>(
+            static_cast<std::remove_reference_t<copy_cv_t<Tptr&, void>>*>(&ptr));
+    }
+}
+
 /// @brief  The bitfield_props class stores the bitfield location information.
 /// @tparam FIRST_BIT: the lowest occupied bit position
 /// @tparam LAST_BIT: the highest occupied bit position
@@ -58,7 +75,16 @@ struct bitfield_props
     template <typename T = unsigned>
     constexpr static T mask()
     {
-        return ((1 << size_bits()) - 1);
+        // computed in the widest unsigned type, as the field may be wider than an int,
+        // and T may be bool or an enumeration, then narrowed to T
+        if constexpr (size_bits() >= std::numeric_limits<std::uintmax_t>::digits)
+        {
+            return static_cast<T>(~std::uintmax_t{});
+        }
+        else
+        {
+            return static_cast<T>((std::uintmax_t{1} << size_bits()) - 1u);
+        }
     }
     template <typename T>
     constexpr static T extract_field(T memory)
@@ -142,17 +168,17 @@ struct base
 
       protected:
         template <typename Tptr>
-        static auto getter(Tptr& ptr)
+        static constexpr auto getter(Tptr& ptr)
         {
-            return static_cast<int_type>((copy_cv_t<Tptr&, T>)ptr);
+            return static_cast<int_type>(owner_cast<T>(ptr));
         }
         template <typename Tptr>
-        static void setter(Tptr& ptr, int_type v)
+        static constexpr void setter(Tptr& ptr, int_type v)
         {
             // NOLINTNEXTLINE(bugprone-assignment-in-if-condition)
-            if constexpr (std::is_void_v<decltype((copy_cv_t<Tptr&, T>)ptr = v)>)
+            if constexpr (std::is_void_v<decltype(owner_cast<T>(ptr) = v)>)
             {
-                (copy_cv_t<Tptr&, T>)ptr = v;
+                owner_cast<T>(ptr) = v;
             }
             else
             {
@@ -160,11 +186,42 @@ struct base
                 // avoid reading it by keeping it a reference, and casting away the qualifier
                 // all this is to avoid warnings
                 // NOLINTNEXTLINE(readability-identifier-length)
-                [[maybe_unused]] auto& _ = const_cast<T&>((copy_cv_t<Tptr&, T>)ptr = v);
+                [[maybe_unused]] auto& _ = const_cast<T&>(owner_cast<T>(ptr) = v);
             }
         }
 
       public:
+        /// @brief  Reads the whole value of the owner in a single access.
+        template <typename Tptr>
+        static constexpr int_type get_value(const Tptr& ptr)
+            requires(is_readable<bitfield_ops::access()>)
+        {
+            return getter(ptr);
+        }
+        /// @brief  Writes the whole value of the owner in a single access.
+        template <typename Tptr>
+        static constexpr void set_value(Tptr& ptr, int_type value)
+            requires(is_writeable<bitfield_ops::access()>)
+        {
+            setter(ptr, value);
+        }
+        /// @brief  Replaces the masked bits of the owner with a single read-modify-write cycle
+        ///         (or a single write, when the owner's current value cannot be read back).
+        template <typename Tptr>
+        static constexpr void modify_value(Tptr& ptr, int_type mask, int_type value)
+            requires(is_writeable<bitfield_ops::access()>)
+        {
+            if constexpr (!is_readable<bitfield_ops::access()> or
+                          is_ephemeralwrite<bitfield_ops::access()>)
+            {
+                setter(ptr, static_cast<int_type>(value & mask));
+            }
+            else
+            {
+                setter(ptr, static_cast<int_type>((getter(ptr) & ~mask) | (value & mask)));
+            }
+        }
+
         template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
         static void set_field(BITFILLED_FIELD_PROPS_PARAM_T& bf, TVal value)
             requires(is_writeable<bitfield_ops::access()>)
@@ -270,4 +327,18 @@ struct base
     };
 };
 
+/// @brief  Describes how the bitfield operations of an ops policy write the owner,
+///         for those which observe the bus accesses (e.g. @ref traced).
+///         By default, the fields are written with a read-modify-write of the owner.
+/// @tparam TOps: the ops policy (e.g. @ref base)
+template <typename TOps>
+struct write_traits
+{
+    /// @brief  Whether a field (or field set item) of the given size is written with stores only,
+    ///         without reading the owner.
+    static constexpr bool stores_field(std::size_t) { return false; }
+    /// @brief  Whether modify_value() writes the owner with stores only, without reading it.
+    static constexpr bool stores_modify() { return false; }
+};
+
 } // namespace bitfilled
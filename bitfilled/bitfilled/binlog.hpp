@@ -0,0 +1,209 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include "bitfilled/transaction.hpp"
+
+namespace bitfilled
+{
+/// @brief  The interpretation of a field's bits in the layout metadata.
+enum class field_kind : std::uint8_t
+{
+    unsigned_integer = 0,
+    signed_integer = 1,
+    boolean = 2,
+    enumeration = 3,
+};
+
+/// @brief  The metadata of a single field of a layout, for decoding the logged values offline.
+struct field_info
+{
+    std::string_view name;
+    std::uint8_t first_bit;
+    std::uint8_t width; // the size of an item, in bits
+    std::uint8_t count; // the number of items (1 for regular fields)
+    field_kind kind;
+};
+
+/// @brief  The stable 32-bit ID of a layout name (FNV-1a), which the tools compute the same way.
+constexpr std::uint32_t layout_id(std::string_view name)
+{
+    std::uint32_t hash = 2166136261u;
+    for (const char c : name)
+    {
+        hash = (hash ^ static_cast<std::uint8_t>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+/// @brief  The layout metadata of a type: its name, ID, value size and fields.
+///         It is specialized for each logged type by the BF_LAYOUT macro.
+template <typename T>
+struct layout_info;
+
+/// @brief  A type whose snapshots can be logged: it has an integral value and layout metadata.
+template <typename T>
+concept LoggableLayout = std::integral<typename T::value_type> and
+                         requires { layout_info<T>::id; layout_info<T>::fields; };
+
+/// @brief  The metadata of a bitfield member, used by the BF_LAYOUT macro.
+/// @tparam MEMBER: the bitfield member pointer, e.g. &periph_t::CTRL_t::EN
+/// @param  name: the name of the member
+template <auto MEMBER>
+constexpr field_info make_field_info(std::string_view name)
+{
+    using field_type = typename field_ref<MEMBER>::field_type;
+    using value_type = typename field_type::value_type;
+    using props_type = typename field_type::props_type;
+    static_assert(sizeof(value_type) <= sizeof(std::uint64_t));
+
+    field_info info{.name = name,
+                    .first_bit = 0,
+                    .width = static_cast<std::uint8_t>(props_type::size_bits()),
+                    .count = 1,
+                    .kind = field_kind::unsigned_integer};
+    if constexpr (field_type::dynamic_index)
+    {
+        info.first_bit = static_cast<std::uint8_t>(props_type::offset(0));
+        info.count = static_cast<std::uint8_t>(field_type::size());
+    }
+    else
+    {
+        info.first_bit = static_cast<std::uint8_t>(props_type::offset());
+    }
+    if constexpr (std::is_same_v<value_type, bool>)
+    {
+        info.kind = field_kind::boolean;
+    }
+    else if constexpr (std::is_enum_v<value_type>)
+    {
+        info.kind = field_kind::enumeration;
+    }
+    else if constexpr (std::is_signed_v<value_type>)
+    {
+        info.kind = field_kind::signed_integer;
+    }
+    return info;
+}
+
+namespace detail
+{
+inline constexpr std::uint32_t binlog_magic = 0x474c4642; // "BFLG" in little endian
+inline constexpr std::size_t binlog_record_header = sizeof(std::uint32_t) + 1;
+} // namespace detail
+
+/// @brief  The binlog class is a binary log buffer for each thread, which keeps snapshots
+///         of registers and records (a @ref host_integer, @ref mmreg or @ref packed_integer
+///         with BF_LAYOUT metadata) without decoding them: a record consists of the
+///         4 byte ID of the type, the size of the value, and the raw value (in native byte order).
+///         The records are expanded into named fields offline, by tools/binlog_decode.py.
+///         When the buffer is full, the new records are dropped (and counted)
+///         until the owning thread flushes it.
+/// @tparam CAPACITY: the buffer size of each thread, in bytes
+template <std::size_t CAPACITY = 16384>
+class binlog
+{
+  public:
+    /// @brief  The calling thread's buffer.
+    static binlog& local()
+    {
+        thread_local binlog log;
+        return log;
+    }
+
+    /// @brief  Appends the snapshot of the object's value (read with a single access).
+    template <typename T>
+    void append(const T& object)
+    {
+        using layout_type = std::remove_cv_t<T>;
+        static_assert(LoggableLayout<layout_type>, "the type needs BF_LAYOUT metadata");
+        using value_type = typename layout_type::value_type;
+        constexpr auto id = layout_info<layout_type>::id;
+        constexpr auto record_size = detail::binlog_record_header + sizeof(value_type);
+
+        const auto value = static_cast<value_type>(object);
+        if ((CAPACITY - size_) < record_size)
+        {
+            ++dropped_;
+            return;
+        }
+        auto* record = buffer_.data() + size_;
+        std::memcpy(record, &id, sizeof(id));
+        record[sizeof(id)] = static_cast<std::byte>(sizeof(value_type));
+        std::memcpy(record + detail::binlog_record_header, &value, sizeof(value));
+        size_ += record_size;
+    }
+
+    /// @brief  The records appended since the last flush.
+    std::span<const std::byte> records() const { return {buffer_.data(), size_}; }
+    /// @brief  The number of records dropped, because the buffer was full.
+    std::size_t dropped() const { return dropped_; }
+    static constexpr std::size_t capacity() { return CAPACITY; }
+    void clear() { size_ = 0; }
+
+    /// @brief  Writes the records as a chunk of the binary log file (the magic number,
+    ///         the byte count and the records), and clears the buffer.
+    /// @return true if the chunk was written
+    bool flush(std::FILE* file)
+    {
+        const std::uint32_t header[2] = {detail::binlog_magic, static_cast<std::uint32_t>(size_)};
+        const bool written = (std::fwrite(header, sizeof(header), 1, file) == 1) and
+                             ((size_ == 0) or (std::fwrite(buffer_.data(), size_, 1, file) == 1));
+        clear();
+        return written;
+    }
+
+  private:
+    std::array<std::byte, CAPACITY> buffer_{};
+    std::size_t size_{};
+    std::size_t dropped_{};
+};
+
+/// @brief  Logs the snapshot of a register or record in the calling thread's @ref binlog.
+template <typename T>
+void log_snapshot(const T& object)
+{
+    binlog<>::local().append(object);
+}
+
+/// @brief  Writes the layout metadata of the given types as JSON, the input of
+///         tools/binlog_decode.py (next to the metadata generated by tools/svd2mmregmap.py).
+template <typename... TLayouts>
+void write_layouts(std::FILE* file)
+{
+    static constexpr std::array<const char*, 4> kinds{"unsigned", "signed", "bool", "enum"};
+    std::fputs("{\"layouts\": [", file);
+    const char* separator = "";
+    const auto write_layout = [&]<typename TLayout>()
+    {
+        using info = layout_info<TLayout>;
+        std::fprintf(file, "%s\n  {\"name\": \"%.*s\", \"id\": %lu, \"size\": %zu, \"fields\": [",
+                     separator, static_cast<int>(info::name.size()), info::name.data(),
+                     static_cast<unsigned long>(info::id), sizeof(typename TLayout::value_type));
+        const char* field_separator = "";
+        for (const auto& field : info::fields)
+        {
+            std::fprintf(file,
+                         "%s\n    {\"name\": \"%.*s\", \"first_bit\": %u, \"width\": %u, "
+                         "\"count\": %u, \"kind\": \"%s\"}",
+                         field_separator, static_cast<int>(field.name.size()), field.name.data(),
+                         static_cast<unsigned>(field.first_bit), static_cast<unsigned>(field.width),
+                         static_cast<unsigned>(field.count),
+                         kinds[static_cast<std::size_t>(field.kind)]);
+            field_separator = ",";
+        }
+        std::fputs("]}", file);
+        separator = ",";
+    };
+    (write_layout.template operator()<TLayouts>(), ...);
+    std::fputs("\n]}\n", file);
+}
+
+} // namespace bitfilled
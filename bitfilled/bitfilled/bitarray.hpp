@@ -0,0 +1,202 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include "bitfilled/base_ops.hpp"
+
+namespace bitfilled
+{
+namespace detail
+{
+/// @brief  The bitarray_ops class defines the bitfield operations on multi-word bit arrays,
+///         where the fields may straddle word boundaries.
+/// @tparam T: The owner type, which provides the get_bits() and set_bits() operations
+template <typename T>
+struct bitarray_ops
+{
+    static constexpr enum access access() { return access::readwrite; }
+
+    template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+    constexpr static void set_field(BITFILLED_FIELD_PROPS_PARAM_T& bf, TVal value)
+    {
+        using props = bitfield_props<FIRST_BIT, LAST_BIT>;
+        static_assert(LAST_BIT < T::size(), "the field is out of the array's range");
+        owner_cast<T>(bf).set_bits(FIRST_BIT, props::size_bits(),
+                                   static_cast<std::uint64_t>(value));
+    }
+    template <typename TVal, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+    constexpr static TVal get_field(const BITFILLED_FIELD_PROPS_PARAM_T& bf)
+    {
+        using props = bitfield_props<FIRST_BIT, LAST_BIT>;
+        static_assert(LAST_BIT < T::size(), "the field is out of the array's range");
+        auto typeval =
+            static_cast<TVal>(owner_cast<T>(bf).get_bits(FIRST_BIT, props::size_bits()));
+        return props::sign_extend(typeval);
+    }
+
+    template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+    constexpr static void set_item(BITFILLED_FIELDSET_PROPS_PARAM_T& bf, std::size_t index,
+                                   TVal value)
+    {
+        using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+        static_assert(OFFSET + ITEM_SIZE * ITEM_COUNT <= T::size(),
+                      "the field set is out of the array's range");
+        owner_cast<T>(bf).set_bits(props::offset(index), ITEM_SIZE,
+                                   static_cast<std::uint64_t>(value));
+    }
+    template <typename TVal, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+    constexpr static TVal get_item(const BITFILLED_FIELDSET_PROPS_PARAM_T& bf, std::size_t index)
+    {
+        using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+        static_assert(OFFSET + ITEM_SIZE * ITEM_COUNT <= T::size(),
+                      "the field set is out of the array's range");
+        auto typeval = static_cast<TVal>(owner_cast<T>(bf).get_bits(props::offset(index), ITEM_SIZE));
+        return props::sign_extend(typeval);
+    }
+};
+} // namespace detail
+
+/// @brief  The host_bitarray class stores a fixed size bit array in multiple words,
+///         provides word-at-a-time bit scanning and range operations,
+///         and allows defining bitfields at any position (including across word boundaries).
+/// @tparam N: the number of bits in the array
+/// @tparam Word: the unsigned integral type of the storage words
+template <std::size_t N, std::unsigned_integral Word = std::size_t>
+struct host_bitarray
+{
+    static_assert(N > 0);
+    using superclass = host_bitarray;
+    using word_type = Word;
+    using bf_ops = detail::bitarray_ops<host_bitarray>;
+
+    static constexpr std::size_t word_bits = std::numeric_limits<Word>::digits;
+    static constexpr std::size_t word_count = (N + word_bits - 1) / word_bits;
+    static constexpr Word all_ones = std::numeric_limits<Word>::max();
+
+    constexpr host_bitarray() = default;
+    BITFILLED_OPS_FORWARDING
+
+    static constexpr std::size_t size() { return N; }
+
+    [[nodiscard]] constexpr bool test(std::size_t pos) const
+    {
+        return static_cast<bool>((words_[pos / word_bits] >> (pos % word_bits)) & Word{1});
+    }
+    constexpr void set(std::size_t pos, bool value = true)
+    {
+        const auto bit = static_cast<Word>(Word{1} << (pos % word_bits));
+        auto& word = words_[pos / word_bits];
+        word = value ? static_cast<Word>(word | bit) : static_cast<Word>(word & ~bit);
+    }
+    constexpr void reset(std::size_t pos) { set(pos, false); }
+
+    /// @brief  Reads a bit range of up to 64 bits, which may span multiple words.
+    /// @param  pos: the position of the lowest bit
+    /// @param  width: the number of bits to read
+    [[nodiscard]] constexpr std::uint64_t get_bits(std::size_t pos, std::size_t width) const
+    {
+        std::uint64_t value = 0;
+        for (std::size_t done = 0; done < width;)
+        {
+            const auto shift = (pos + done) % word_bits;
+            const auto chunk = std::min(word_bits - shift, width - done);
+            const auto word = words_[(pos + done) / word_bits];
+            value |= static_cast<std::uint64_t>((word >> shift) & low_mask(chunk)) << done;
+            done += chunk;
+        }
+        return value;
+    }
+    /// @brief  Writes a bit range of up to 64 bits, which may span multiple words.
+    /// @param  pos: the position of the lowest bit
+    /// @param  width: the number of bits to write
+    /// @param  value: the bits to write, the bits above width are ignored
+    constexpr void set_bits(std::size_t pos, std::size_t width, std::uint64_t value)
+    {
+        for (std::size_t done = 0; done < width;)
+        {
+            const auto shift = (pos + done) % word_bits;
+            const auto chunk = std::min(word_bits - shift, width - done);
+            const auto mask = low_mask(chunk);
+            auto& word = words_[(pos + done) / word_bits];
+            word = static_cast<Word>((word & ~(mask << shift)) |
+                                     ((static_cast<Word>(value >> done) & mask) << shift));
+            done += chunk;
+        }
+    }
+
+    /// @brief  Sets all bits in the [first, first + count) range to one.
+    constexpr void set_range(std::size_t first, std::size_t count) { fill(first, count, all_ones); }
+    /// @brief  Clears all bits in the [first, first + count) range to zero.
+    constexpr void clear_range(std::size_t first, std::size_t count) { fill(first, count, Word{}); }
+
+    /// @brief  Counts the set bits in the array.
+    [[nodiscard]] constexpr std::size_t count() const
+    {
+        std::size_t bits = 0;
+        for (auto word : words_)
+        {
+            bits += static_cast<std::size_t>(std::popcount(word));
+        }
+        return bits;
+    }
+    /// @brief  Finds the lowest set bit, starting from a given position.
+    /// @return the position of the bit, or size() if there is none
+    [[nodiscard]] constexpr std::size_t find_first_set(std::size_t from = 0) const
+    {
+        return find_first(from, Word{});
+    }
+    /// @brief  Finds the lowest zero bit, starting from a given position.
+    /// @return the position of the bit, or size() if there is none
+    [[nodiscard]] constexpr std::size_t find_first_zero(std::size_t from = 0) const
+    {
+        return find_first(from, all_ones);
+    }
+
+    [[nodiscard]] constexpr const std::array<Word, word_count>& words() const { return words_; }
+
+  private:
+    std::array<Word, word_count> words_{};
+
+    static constexpr Word low_mask(std::size_t bits)
+    {
+        return bits >= word_bits ? all_ones : static_cast<Word>((Word{1} << bits) - 1u);
+    }
+    constexpr void fill(std::size_t first, std::size_t count, Word pattern)
+    {
+        for (std::size_t done = 0; done < count;)
+        {
+            const auto shift = (first + done) % word_bits;
+            const auto chunk = std::min(word_bits - shift, count - done);
+            const auto mask = static_cast<Word>(low_mask(chunk) << shift);
+            auto& word = words_[(first + done) / word_bits];
+            word = static_cast<Word>((word & ~mask) | (pattern & mask));
+            done += chunk;
+        }
+    }
+    /// @param  invert: the pattern to XOR the words with, before scanning them for set bits
+    constexpr std::size_t find_first(std::size_t from, Word invert) const
+    {
+        if (from >= N)
+        {
+            return N;
+        }
+        auto index = from / word_bits;
+        auto word = static_cast<Word>((words_[index] ^ invert) & (all_ones << (from % word_bits)));
+        while (word == 0)
+        {
+            if (++index == word_count)
+            {
+                return N;
+            }
+            word = static_cast<Word>(words_[index] ^ invert);
+        }
+        return std::min(N, index * word_bits + static_cast<std::size_t>(std::countr_zero(word)));
+    }
+};
+
+} // namespace bitfilled
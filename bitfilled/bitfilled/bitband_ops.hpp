@@ -8,6 +8,19 @@ namespace bitfilled
 template <std::uintptr_t BASE_ADDRESS>
 struct bitband
 {
+    static_assert((BASE_ADDRESS & 0x9fffffff) == 0);
+    static constexpr std::uintptr_t BITBAND_BASE_ADDRESS = BASE_ADDRESS | 0x02000000;
+
+    /// @brief  The alias address of a single bit of the bit-band region.
+    /// @param  address: the (bus) address of the memory containing the bit
+    /// @param  bit_index: the bit's position from the address
+    static constexpr std::uintptr_t alias_address(std::uintptr_t address, std::size_t bit_index)
+    {
+        return BITBAND_BASE_ADDRESS         // remapped base
+               | ((address & 0xfffff) << 5) // word offset
+               | (bit_index << 2);          // bit offset
+    }
+
     /// @brief  These bitfield operations use bit-band memory access for single-bit manipulation,
     ///         as it is implemented on ARM Cortex M3/M4 CPU architectures.
     /// @note   These operations shall only be used on types that map directly to memory
@@ -20,21 +33,52 @@ struct bitband
       private:
         using base_ops = base::bitfield_ops<T, ACCESS>;
         using base_ops::access;
-        using base_ops::int_type;
-        static_assert((BASE_ADDRESS & 0x9fffffff) == 0);
-        static constexpr std::uintptr_t BITBAND_BASE_ADDRESS = BASE_ADDRESS | 0x02000000;
+
+        // owners which aren't located at their bus address (e.g. @ref simulated registers)
+        // perform the bit-band accesses themselves
+        static constexpr bool redirected = requires(std::uintptr_t alias) {
+            T::bus_address(nullptr);
+            T::read_bitband(alias);
+        };
 
         template <typename Tptr>
         static auto& bitmemory(Tptr& ptr, std::size_t bit_index)
         {
-            auto address = BITBAND_BASE_ADDRESS                      // remapped base
-                           | (((std::uintptr_t)&ptr & 0xfffff) << 5) // word offset
-                           | (bit_index << 2);                       // bit offset
+            auto address = alias_address((std::uintptr_t)&ptr, bit_index);
             return *((std::add_pointer_t<std::remove_reference_t<copy_cv_t<Tptr&, std::uint32_t>>>)
                          address);
         }
+        template <typename Tptr>
+        static std::uint32_t read_bit(const Tptr& ptr, std::size_t bit_index)
+        {
+            if constexpr (redirected)
+            {
+                return T::read_bitband(alias_address(T::bus_address(&ptr), bit_index));
+            }
+            else
+            {
+                return bitmemory(ptr, bit_index);
+            }
+        }
+        template <typename Tptr>
+        static void write_bit(Tptr& ptr, std::size_t bit_index, std::uint32_t value)
+        {
+            if constexpr (redirected)
+            {
+                T::write_bitband(alias_address(T::bus_address(&ptr), bit_index), value);
+            }
+            else
+            {
+                bitmemory(ptr, bit_index) = value;
+            }
+        }
 
       public:
+        using base_ops::int_type;
+        using base_ops::get_value;
+        using base_ops::modify_value;
+        using base_ops::set_value;
+
         template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
         static void set_field(bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
             requires(is_writeable<base_ops::access()>)
@@ -42,7 +86,7 @@ struct bitband
             if constexpr (FIRST_BIT == LAST_BIT)
             {
                 const auto intval = static_cast<base_ops::int_type>(value);
-                bitmemory(bf, FIRST_BIT) = intval;
+                write_bit(bf, FIRST_BIT, intval);
             }
             else
             {
@@ -56,7 +100,7 @@ struct bitband
             if constexpr (FIRST_BIT == LAST_BIT)
             {
                 const auto intval = static_cast<base_ops::int_type>(value);
-                bitmemory(bf, FIRST_BIT) = intval;
+                write_bit(bf, FIRST_BIT, intval);
             }
             else
             {
@@ -69,7 +113,7 @@ struct bitband
         {
             if constexpr (FIRST_BIT == LAST_BIT)
             {
-                auto typeval = static_cast<TVal>(bitmemory(bf, FIRST_BIT));
+                auto typeval = static_cast<TVal>(read_bit(bf, FIRST_BIT));
                 return bf.sign_extend(typeval);
             }
             else
@@ -83,7 +127,7 @@ struct bitband
         {
             if constexpr (FIRST_BIT == LAST_BIT)
             {
-                auto typeval = static_cast<TVal>(bitmemory(bf, FIRST_BIT));
+                auto typeval = static_cast<TVal>(read_bit(bf, FIRST_BIT));
                 return bf.sign_extend(typeval);
             }
             else
@@ -99,7 +143,7 @@ struct bitband
             if constexpr (ITEM_SIZE == 1)
             {
                 const auto intval = static_cast<base_ops::int_type>(value);
-                bitmemory(bf, OFFSET + index) = intval;
+                write_bit(bf, OFFSET + index, intval);
             }
             else
             {
@@ -114,7 +158,7 @@ struct bitband
             if constexpr (ITEM_SIZE == 1)
             {
                 const auto intval = static_cast<base_ops::int_type>(value);
-                bitmemory(bf, OFFSET + index) = intval;
+                write_bit(bf, OFFSET + index, intval);
             }
             else
             {
@@ -128,7 +172,7 @@ struct bitband
         {
             if constexpr (ITEM_SIZE == 1)
             {
-                auto typeval = static_cast<TVal>(bitmemory(bf, OFFSET + index));
+                auto typeval = static_cast<TVal>(read_bit(bf, OFFSET + index));
                 return bf.sign_extend(typeval);
             }
             else
@@ -143,7 +187,7 @@ struct bitband
         {
             if constexpr (ITEM_SIZE == 1)
             {
-                auto typeval = static_cast<TVal>(bitmemory(bf, OFFSET + index));
+                auto typeval = static_cast<TVal>(read_bit(bf, OFFSET + index));
                 return bf.sign_extend(typeval);
             }
             else
@@ -154,4 +198,12 @@ struct bitband
     };
 };
 
+/// @brief  Single bits are written with a single store to their bit-band alias.
+template <std::uintptr_t BASE_ADDRESS>
+struct write_traits<bitband<BASE_ADDRESS>>
+{
+    static constexpr bool stores_field(std::size_t size_bits) { return size_bits == 1; }
+    static constexpr bool stores_modify() { return false; }
+};
+
 } // namespace bitfilled
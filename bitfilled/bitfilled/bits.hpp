@@ -1,6 +1,10 @@
 // SPDX-License-Identifier: MPL-2.0
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <iterator>
 #include "bitfilled/base_ops.hpp"
 
 namespace bitfilled
@@ -177,6 +181,93 @@ struct regbitfield
 template <typename T, typename TOps, std::size_t FIRST_BIT, std::size_t LAST_BIT = FIRST_BIT>
 using bitfield = regbitfield<T, TOps, access::readwrite, FIRST_BIT, LAST_BIT>;
 
+/// @brief  The regbitfieldset_iterator class provides random access iteration over the items
+///         of a bitfield set. Dereferencing it is equivalent to the set's operator[].
+/// @tparam TSet: the (cv-qualified) regbitfieldset type
+template <typename TSet>
+class regbitfieldset_iterator
+{
+  public:
+    using iterator_concept = std::random_access_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename std::remove_cv_t<TSet>::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = decltype(std::declval<TSet&>()[0]);
+    using pointer = void;
+
+    constexpr regbitfieldset_iterator() = default;
+    constexpr regbitfieldset_iterator(TSet& set, std::size_t index) : set_(&set), index_(index) {}
+
+    reference operator*() const { return (*set_)[index_]; }
+    reference operator[](difference_type n) const
+    {
+        return (*set_)[static_cast<std::size_t>(static_cast<difference_type>(index_) + n)];
+    }
+
+    constexpr regbitfieldset_iterator& operator++()
+    {
+        ++index_;
+        return *this;
+    }
+    constexpr regbitfieldset_iterator operator++(int)
+    {
+        auto it = *this;
+        ++index_;
+        return it;
+    }
+    constexpr regbitfieldset_iterator& operator--()
+    {
+        --index_;
+        return *this;
+    }
+    constexpr regbitfieldset_iterator operator--(int)
+    {
+        auto it = *this;
+        --index_;
+        return it;
+    }
+    constexpr regbitfieldset_iterator& operator+=(difference_type n)
+    {
+        index_ = static_cast<std::size_t>(static_cast<difference_type>(index_) + n);
+        return *this;
+    }
+    constexpr regbitfieldset_iterator& operator-=(difference_type n) { return *this += -n; }
+    friend constexpr regbitfieldset_iterator operator+(regbitfieldset_iterator it,
+                                                       difference_type n)
+    {
+        return it += n;
+    }
+    friend constexpr regbitfieldset_iterator operator+(difference_type n,
+                                                       regbitfieldset_iterator it)
+    {
+        return it += n;
+    }
+    friend constexpr regbitfieldset_iterator operator-(regbitfieldset_iterator it,
+                                                       difference_type n)
+    {
+        return it -= n;
+    }
+    friend constexpr difference_type operator-(const regbitfieldset_iterator& lhs,
+                                               const regbitfieldset_iterator& rhs)
+    {
+        return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+    friend constexpr bool operator==(const regbitfieldset_iterator& lhs,
+                                     const regbitfieldset_iterator& rhs)
+    {
+        return lhs.index_ == rhs.index_;
+    }
+    friend constexpr auto operator<=>(const regbitfieldset_iterator& lhs,
+                                      const regbitfieldset_iterator& rhs)
+    {
+        return lhs.index_ <=> rhs.index_;
+    }
+
+  private:
+    TSet* set_{};
+    std::size_t index_{};
+};
+
 template <typename T, typename TOps, enum access ACCESS, std::size_t ITEM_SIZE,
           std::size_t ITEM_COUNT, std::size_t OFFSET = 0>
 struct regbitfieldset
@@ -191,6 +282,11 @@ struct regbitfieldset
     static constexpr std::size_t size() { return ITEM_COUNT; }
 
     constexpr regbitfieldset() = default;
+    regbitfieldset(std::initializer_list<T> values)
+        requires(is_writeable<ACCESS>)
+    {
+        assign(values);
+    }
 
     ~regbitfieldset() = default;
     regbitfieldset(regbitfieldset&&) = delete;
@@ -230,20 +326,24 @@ struct regbitfieldset
     // clang-format on
     auto
     operator[](std::size_t pos) const
+        requires(is_readable<ACCESS>)
     {
         return TOps::template get_item<T>((const props_type&)*this, pos);
     }
+    // clang-format off
     auto operator[](std::size_t pos) const volatile
+        requires(is_readable<ACCESS>)
     {
         return TOps::template get_item<T>((const volatile props_type&)*this, pos);
     }
+    // clang-format on
     auto operator[](std::size_t pos)
         requires(is_readonly<ACCESS>)
     {
         return TOps::template get_item<T>((props_type&)*this, pos);
     }
     auto operator[](std::size_t pos)
-        requires(is_readwrite<ACCESS>)
+        requires(is_writeable<ACCESS>)
     {
         return regbitfield_reference<regbitfieldset>{(props_type&)*this, pos};
     }
@@ -254,14 +354,209 @@ struct regbitfieldset
         return TOps::template get_item<T>((volatile props_type&)*this, pos);
     }
     auto operator[](std::size_t pos) volatile
-        requires(is_readwrite<ACCESS>)
+        requires(is_writeable<ACCESS>)
     {
         return regbitfield_reference<regbitfieldset, true>{(volatile props_type&)*this, pos};
     }
     // clang-format on
 
-    // TODO: iterators, reverse iterators
-    // TODO: initializer list constructor
+    /// @brief  Reads the item at a compile-time index.
+    template <std::size_t INDEX>
+    T get() const
+        requires(is_readable<ACCESS>)
+    {
+        return TOps::template get_field<T>((const item_props<INDEX>&)*this);
+    }
+    // clang-format off
+    template <std::size_t INDEX>
+    T get() const volatile
+        requires(is_readable<ACCESS>)
+    {
+        return TOps::template get_field<T>((const volatile item_props<INDEX>&)*this);
+    }
+    // clang-format on
+    /// @brief  Writes the item at a compile-time index.
+    template <std::size_t INDEX>
+    void set(T value)
+        requires(is_writeable<ACCESS>)
+    {
+        TOps::set_field((item_props<INDEX>&)*this, value);
+    }
+    // clang-format off
+    template <std::size_t INDEX>
+    void set(T value) volatile
+        requires(is_writeable<ACCESS>)
+    {
+        TOps::set_field((volatile item_props<INDEX>&)*this, value);
+    }
+    // clang-format on
+
+    /// @brief  Writes all items to the same value, with a single write access.
+    void fill(T value)
+        requires(is_writeable<ACCESS>)
+    {
+        fill(*this, value);
+    }
+    // clang-format off
+    void fill(T value) volatile
+        requires(is_writeable<ACCESS>)
+    {
+        fill(*this, value);
+    }
+    // clang-format on
+    /// @brief  Writes the items from the start of the set with the listed values,
+    ///         with a single write access.
+    void assign(std::initializer_list<T> values)
+        requires(is_writeable<ACCESS>)
+    {
+        assign(*this, values);
+    }
+    // clang-format off
+    void assign(std::initializer_list<T> values) volatile
+        requires(is_writeable<ACCESS>)
+    {
+        assign(*this, values);
+    }
+    // clang-format on
+    /// @brief  Counts the items with the given value, with a single read access.
+    [[nodiscard]] std::size_t count(T value) const
+        requires(is_readable<ACCESS>)
+    {
+        return count(*this, value);
+    }
+    // clang-format off
+    [[nodiscard]] std::size_t count(T value) const volatile
+        requires(is_readable<ACCESS>)
+    {
+        return count(*this, value);
+    }
+    // clang-format on
+    /// @brief  Finds the first item with the given value, with a single read access.
+    /// @return the index of the item, or size() if not found
+    [[nodiscard]] std::size_t find(T value) const
+        requires(is_readable<ACCESS>)
+    {
+        return find(*this, value);
+    }
+    // clang-format off
+    [[nodiscard]] std::size_t find(T value) const volatile
+        requires(is_readable<ACCESS>)
+    {
+        return find(*this, value);
+    }
+    // clang-format on
+
+    auto begin() { return regbitfieldset_iterator<regbitfieldset>(*this, 0); }
+    auto begin() const { return regbitfieldset_iterator<const regbitfieldset>(*this, 0); }
+    auto begin() volatile { return regbitfieldset_iterator<volatile regbitfieldset>(*this, 0); }
+    auto begin() const volatile
+    {
+        return regbitfieldset_iterator<const volatile regbitfieldset>(*this, 0);
+    }
+    auto end() { return begin() + ITEM_COUNT; }
+    auto end() const { return begin() + ITEM_COUNT; }
+    auto end() volatile { return begin() + ITEM_COUNT; }
+    auto end() const volatile { return begin() + ITEM_COUNT; }
+    auto rbegin() { return std::reverse_iterator(end()); }
+    auto rbegin() const { return std::reverse_iterator(end()); }
+    auto rbegin() volatile { return std::reverse_iterator(end()); }
+    auto rbegin() const volatile { return std::reverse_iterator(end()); }
+    auto rend() { return std::reverse_iterator(begin()); }
+    auto rend() const { return std::reverse_iterator(begin()); }
+    auto rend() volatile { return std::reverse_iterator(begin()); }
+    auto rend() const volatile { return std::reverse_iterator(begin()); }
+
+  private:
+    template <std::size_t INDEX>
+    struct item_props_of
+    {
+        static_assert(INDEX < ITEM_COUNT, "the item index is out of range");
+        using type =
+            bitfield_props<props_type::offset(INDEX), props_type::offset(INDEX) + ITEM_SIZE - 1>;
+    };
+    template <std::size_t INDEX>
+    using item_props = typename item_props_of<INDEX>::type;
+
+    // whether the ops provide access to the whole owner value
+    static constexpr bool whole_readable =
+        requires(const props_type& props) { TOps::get_value(props); };
+    static constexpr bool whole_writeable =
+        requires(props_type& props) { TOps::modify_value(props, 0, 0); };
+
+    /// @brief  Writes the first COUNT items, with a single write access when the ops allow it.
+    /// @param  item: callable returning the new value of the item at the given index
+    template <typename TSelf, typename TItem>
+    static void write(TSelf& self, std::size_t count, TItem item)
+    {
+        auto& props = (copy_cv_t<TSelf&, props_type>)self;
+        if constexpr (whole_writeable)
+        {
+            using int_type = typename TOps::int_type;
+            int_type mask{};
+            int_type value{};
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                mask |= props_type::position_field(static_cast<int_type>(~int_type{}), index);
+                value |= props_type::position_field(static_cast<int_type>(item(index)), index);
+            }
+            TOps::modify_value(props, mask, value);
+        }
+        else
+        {
+            for (std::size_t index = 0; index < count; ++index)
+            {
+                TOps::set_item(props, index, item(index));
+            }
+        }
+    }
+    template <typename TSelf>
+    static void fill(TSelf& self, T value)
+    {
+        write(self, ITEM_COUNT, [value](std::size_t) { return value; });
+    }
+    template <typename TSelf>
+    static void assign(TSelf& self, std::initializer_list<T> values)
+    {
+        write(self, std::min(values.size(), ITEM_COUNT),
+              [&values](std::size_t index) { return std::data(values)[index]; });
+    }
+    /// @brief  Reads all items, with a single read access when the ops allow it.
+    template <typename TSelf>
+    static std::array<T, ITEM_COUNT> read_all(TSelf& self)
+    {
+        auto& props = (copy_cv_t<TSelf&, props_type>)self;
+        std::array<T, ITEM_COUNT> items{};
+        if constexpr (whole_readable)
+        {
+            const auto value = TOps::get_value(props);
+            for (std::size_t index = 0; index < ITEM_COUNT; ++index)
+            {
+                items[index] = props_type::sign_extend(
+                    static_cast<T>(props_type::extract_field(value, index)));
+            }
+        }
+        else
+        {
+            for (std::size_t index = 0; index < ITEM_COUNT; ++index)
+            {
+                items[index] = TOps::template get_item<T>(props, index);
+            }
+        }
+        return items;
+    }
+    template <typename TSelf>
+    static std::size_t count(TSelf& self, T value)
+    {
+        const auto items = read_all(self);
+        return static_cast<std::size_t>(std::count(items.begin(), items.end(), value));
+    }
+    template <typename TSelf>
+    static std::size_t find(TSelf& self, T value)
+    {
+        const auto items = read_all(self);
+        return static_cast<std::size_t>(std::find(items.begin(), items.end(), value) -
+                                        items.begin());
+    }
 };
 
 /// @brief  The bitfield is a shortcut to define bitfields in variables.
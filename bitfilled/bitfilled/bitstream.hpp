@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "bitfilled/integer.hpp"
+
+namespace bitfilled
+{
+/// @brief  The order in which the bits of each stream byte follow each other.
+enum class bit_order
+{
+    msb_first, ///< the most significant bit of a byte comes first (e.g. ASN.1 PER, H.264)
+    lsb_first, ///< the least significant bit of a byte comes first (e.g. DEFLATE, CAN signals)
+};
+
+/// @brief  A bit layout type, whose value can be read or written as one chunk of a bit stream
+///         (e.g. a @ref host_integer subclass with bitfield members).
+template <typename T>
+concept BitLayout = requires { typename T::bf_ops; } and std::integral<typename T::value_type>;
+
+/// @brief  The bit_reader class reads fields of arbitrary width from a byte stream,
+///         where they are packed back to back at arbitrary bit offsets.
+///         The bits are buffered in a 64-bit accumulator, which is refilled to (at least) 56 bits
+///         with a single unaligned load, when the next field doesn't fit in the buffered bits.
+///         Reading beyond the end of the stream returns zero bits, and is reported as an error.
+/// @tparam ORDER: the bit order of the stream
+template <bit_order ORDER = bit_order::msb_first>
+class bit_reader
+{
+  public:
+    static constexpr auto order = ORDER;
+
+    constexpr bit_reader() = default;
+    explicit bit_reader(std::span<const std::byte> bytes)
+        : begin_(reinterpret_cast<const sized_unsigned_t<1>*>(bytes.data())),
+          next_(begin_),
+          end_(begin_ + bytes.size())
+    {}
+
+    /// @brief  Whether all the reads were within the stream.
+    explicit operator bool() const { return !overrun_; }
+    /// @brief  The number of bits read from the stream.
+    std::size_t position() const { return static_cast<std::size_t>(next_ - begin_) * 8 - count_; }
+    /// @brief  The number of bits left in the stream.
+    std::size_t remaining() const
+    {
+        return (static_cast<std::size_t>(end_ - begin_) * 8) - position();
+    }
+
+    /// @brief  Reads the next bits of the stream.
+    /// @param  width: the number of bits to read, at most 64
+    /// @return the bits, the first read bit being the most significant (msb_first)
+    ///         or the least significant (lsb_first) of the width
+    std::uint64_t read(std::size_t width)
+    {
+        assert(width <= 64);
+        if (width <= chunk_bits)
+        {
+            return read_chunk(width);
+        }
+        const auto first = read_chunk(32);
+        const auto second = read_chunk(width - 32);
+        return (ORDER == bit_order::msb_first) ? ((first << (width - 32)) | second)
+                                               : (first | (second << 32));
+    }
+    /// @brief  Reads a whole bit layout (e.g. a header with bitfield members) as one chunk.
+    /// @tparam TLayout: the layout type
+    /// @tparam BITS: the number of stream bits the layout takes (the lowest bits of its value)
+    template <BitLayout TLayout, std::size_t BITS = sizeof(typename TLayout::value_type) * 8>
+    TLayout read()
+    {
+        static_assert(BITS <= sizeof(typename TLayout::value_type) * 8);
+        TLayout layout{};
+        layout = static_cast<typename TLayout::value_type>(read(BITS));
+        return layout;
+    }
+
+    /// @brief  Skips the next bits of the stream.
+    void skip(std::size_t width)
+    {
+        for (; width > chunk_bits; width -= chunk_bits)
+        {
+            read_chunk(chunk_bits);
+        }
+        read_chunk(width);
+    }
+    /// @brief  Skips to the next byte boundary of the stream.
+    void align() { skip((8 - (position() % 8)) % 8); }
+
+  private:
+    static constexpr std::size_t chunk_bits = 56;
+    static constexpr std::endian word_endianness =
+        (ORDER == bit_order::msb_first) ? std::endian::big : std::endian::little;
+
+    void refill()
+    {
+        if ((end_ - next_) >= 8)
+        {
+            // the bits loaded beyond the count are loaded again by the next refill
+            const auto word = detail::load_packed<8, std::uint64_t>(next_, word_endianness);
+            acc_ |= (ORDER == bit_order::msb_first) ? (word >> count_) : (word << count_);
+            next_ += (63 - count_) / 8;
+            count_ |= 56;
+        }
+        else
+        {
+            for (; (count_ <= 56) and (next_ != end_); count_ += 8)
+            {
+                const auto byte = static_cast<std::uint64_t>(*next_++);
+                acc_ |= (ORDER == bit_order::msb_first) ? (byte << (56 - count_))
+                                                        : (byte << count_);
+            }
+        }
+    }
+    std::uint64_t read_chunk(std::size_t width)
+    {
+        if (count_ < width)
+        {
+            refill();
+            if (count_ < width)
+            {
+                overrun_ = true;
+                acc_ = 0;
+                count_ = 0;
+                return 0;
+            }
+        }
+        std::uint64_t value;
+        if constexpr (ORDER == bit_order::msb_first)
+        {
+            // shifted in two steps, to allow zero width
+            value = (acc_ >> 1) >> (63 - width);
+            acc_ <<= width;
+        }
+        else
+        {
+            value = acc_ & ((std::uint64_t{1} << width) - 1);
+            acc_ >>= width;
+        }
+        count_ -= width;
+        return value;
+    }
+
+    const sized_unsigned_t<1>* begin_{};
+    const sized_unsigned_t<1>* next_{};
+    const sized_unsigned_t<1>* end_{};
+    std::uint64_t acc_{};
+    std::size_t count_{};
+    bool overrun_{};
+};
+
+/// @brief  The bit_writer class writes fields of arbitrary width to a byte stream,
+///         packing them back to back at arbitrary bit offsets.
+///         The bits are buffered in a 64-bit accumulator, which is stored to the stream
+///         with a single unaligned store whenever 32 bits are complete.
+///         Writing beyond the end of the buffer is dropped, and is reported as an error.
+/// @tparam ORDER: the bit order of the stream
+template <bit_order ORDER = bit_order::msb_first>
+class bit_writer
+{
+  public:
+    static constexpr auto order = ORDER;
+
+    constexpr bit_writer() = default;
+    explicit bit_writer(std::span<std::byte> bytes)
+        : begin_(reinterpret_cast<sized_unsigned_t<1>*>(bytes.data())),
+          next_(begin_),
+          end_(begin_ + bytes.size())
+    {}
+
+    /// @brief  Whether all the writes fit in the buffer.
+    explicit operator bool() const { return !overrun_; }
+    /// @brief  The number of bits written to the stream.
+    std::size_t position() const { return static_cast<std::size_t>(next_ - begin_) * 8 + count_; }
+
+    /// @brief  Writes the next bits of the stream.
+    /// @param  value: the bits to write, the bits above the width are ignored
+    /// @param  width: the number of bits to write, at most 64
+    void write(std::uint64_t value, std::size_t width)
+    {
+        assert(width <= 64);
+        if (width <= chunk_bits)
+        {
+            write_chunk(value, width);
+        }
+        else if constexpr (ORDER == bit_order::msb_first)
+        {
+            write_chunk(value >> 32, width - 32);
+            write_chunk(value, 32);
+        }
+        else
+        {
+            write_chunk(value, 32);
+            write_chunk(value >> 32, width - 32);
+        }
+    }
+    /// @brief  Writes a whole bit layout (e.g. a header with bitfield members) as one chunk.
+    /// @tparam BITS: the number of stream bits the layout takes (the lowest bits of its value)
+    /// @param  layout: the layout object
+    template <std::size_t BITS = 0, BitLayout TLayout>
+    void write(const TLayout& layout)
+    {
+        using value_type = typename TLayout::value_type;
+        constexpr auto bits = (BITS > 0) ? BITS : (sizeof(value_type) * 8);
+        static_assert(bits <= sizeof(value_type) * 8);
+        write(static_cast<std::make_unsigned_t<value_type>>(static_cast<value_type>(layout)),
+              bits);
+    }
+
+    /// @brief  Writes zero bits up to the next byte boundary of the stream.
+    void align() { write(0, (8 - (position() % 8)) % 8); }
+    /// @brief  Stores the buffered bits to the buffer, the last byte padded with zero bits.
+    ///         Call this once, after the last write.
+    /// @return the number of bytes written to the buffer
+    std::size_t flush()
+    {
+        const auto bytes = (count_ + 7) / 8;
+        const auto word = (ORDER == bit_order::msb_first) ? (acc_ << (32 - count_)) : acc_;
+        for (std::size_t i = 0; i < bytes; ++i)
+        {
+            const auto shift = (ORDER == bit_order::msb_first) ? (24 - i * 8) : (i * 8);
+            store_byte(static_cast<sized_unsigned_t<1>>(word >> shift));
+        }
+        acc_ = 0;
+        count_ = 0;
+        return static_cast<std::size_t>(next_ - begin_);
+    }
+
+  private:
+    static constexpr std::size_t chunk_bits = 32;
+    static constexpr std::endian word_endianness =
+        (ORDER == bit_order::msb_first) ? std::endian::big : std::endian::little;
+
+    void store_byte(sized_unsigned_t<1> byte)
+    {
+        if (next_ != end_)
+        {
+            *next_++ = byte;
+        }
+        else
+        {
+            overrun_ = true;
+        }
+    }
+    void store_word(std::uint32_t word)
+    {
+        if ((end_ - next_) >= 4)
+        {
+            detail::store_packed<4>(next_, word, word_endianness);
+            next_ += 4;
+            return;
+        }
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            const auto shift = (ORDER == bit_order::msb_first) ? (24 - i * 8) : (i * 8);
+            store_byte(static_cast<sized_unsigned_t<1>>(word >> shift));
+        }
+    }
+    void write_chunk(std::uint64_t value, std::size_t width)
+    {
+        value &= (std::uint64_t{1} << width) - 1;
+        if constexpr (ORDER == bit_order::msb_first)
+        {
+            acc_ = (acc_ << width) | value;
+            count_ += width;
+            if (count_ >= 32)
+            {
+                count_ -= 32;
+                store_word(static_cast<std::uint32_t>(acc_ >> count_));
+            }
+        }
+        else
+        {
+            acc_ |= value << count_;
+            count_ += width;
+            if (count_ >= 32)
+            {
+                store_word(static_cast<std::uint32_t>(acc_));
+                acc_ >>= 32;
+                count_ -= 32;
+            }
+        }
+    }
+
+    sized_unsigned_t<1>* begin_{};
+    sized_unsigned_t<1>* next_{};
+    sized_unsigned_t<1>* end_{};
+    std::uint64_t acc_{};
+    std::size_t count_{};
+    bool overrun_{};
+};
+
+} // namespace bitfilled
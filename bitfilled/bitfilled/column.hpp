@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <span>
+#include "bitfilled/transaction.hpp"
+
+namespace bitfilled
+{
+namespace detail
+{
+/// @brief  The number of records processed together by the column operations.
+inline constexpr std::size_t column_block = 16;
+
+template <typename TRec, typename TClass, typename TField>
+constexpr void check_column()
+{
+    static_assert(!std::is_volatile_v<TRec>, "the records must be in regular memory");
+    static_assert(detail::members_of<TRec, TClass>, "the field must be a member of the records");
+}
+
+/// @brief  Extracts a field from the integer value of its owner, using only shift operations,
+///         so that the loops using it can be vectorized.
+template <typename TField, typename TInt>
+constexpr typename TField::value_type extract_column_item(TInt value)
+{
+    using props_type = typename TField::props_type;
+    using value_type = typename TField::value_type;
+    // all bits of the owner's value, including the sign bit of a signed type
+    constexpr auto digits = sizeof(TInt) * 8;
+    constexpr auto last_bit = props_type::offset() + props_type::size_bits() - 1;
+
+    if constexpr (std::is_signed_v<value_type>)
+    {
+        // move the field's sign bit to the top, then shift it back arithmetically
+        using signed_type = std::make_signed_t<TInt>;
+        using unsigned_type = std::make_unsigned_t<TInt>;
+        const auto moved =
+            static_cast<unsigned_type>(static_cast<unsigned_type>(value) << (digits - 1 - last_bit));
+        const auto top = static_cast<signed_type>(moved);
+        return static_cast<value_type>(top >> (digits - props_type::size_bits()));
+    }
+    else
+    {
+        return static_cast<value_type>(props_type::extract_field(value));
+    }
+}
+} // namespace detail
+
+/// @brief  Reads the same bitfield from each element of an array of records.
+/// @param  records: the records (@ref host_integer or @ref packed_integer subclasses)
+/// @param  member: the bitfield member pointer, e.g. &record::FIELD
+/// @param  out: the destination of the field values, at least as long as records
+/// @note   The records are processed in blocks through a local buffer, so the loops
+///         only consist of loads, shifts and masks without possible aliasing,
+///         which allows the compiler to vectorize them for the target instruction set.
+template <typename TRec, std::size_t N, typename TClass, typename TField, typename TOut,
+          std::size_t M>
+void extract_column(std::span<TRec, N> records, [[maybe_unused]] TField TClass::*member,
+                    std::span<TOut, M> out)
+{
+    using record_type = std::remove_const_t<TRec>;
+    detail::check_column<record_type, TClass, TField>();
+    static_assert(is_readable<TField::access()>, "the field must be readable");
+    assert(out.size() >= records.size());
+
+    using ops_type = typename record_type::bf_ops;
+    using int_type = typename record_type::value_type;
+    const auto count = records.size();
+    std::size_t i = 0;
+    for (; (i + detail::column_block) <= count; i += detail::column_block)
+    {
+        std::array<int_type, detail::column_block> values;
+        for (std::size_t j = 0; j < detail::column_block; ++j)
+        {
+            values[j] = ops_type::get_value(records[i + j]);
+        }
+        for (std::size_t j = 0; j < detail::column_block; ++j)
+        {
+            out[i + j] = static_cast<TOut>(detail::extract_column_item<TField>(values[j]));
+        }
+    }
+    for (; i < count; ++i)
+    {
+        out[i] = static_cast<TOut>(
+            detail::extract_column_item<TField>(ops_type::get_value(records[i])));
+    }
+}
+
+/// @brief  Writes the same bitfield of each element of an array of records.
+/// @param  records: the records (@ref host_integer or @ref packed_integer subclasses)
+/// @param  member: the bitfield member pointer, e.g. &record::FIELD
+/// @param  in: the new field values, at least as long as records
+template <typename TRec, std::size_t N, typename TClass, typename TField, typename TIn,
+          std::size_t M>
+void scatter_column(std::span<TRec, N> records, [[maybe_unused]] TField TClass::*member,
+                    std::span<TIn, M> in)
+{
+    detail::check_column<TRec, TClass, TField>();
+    static_assert(is_writeable<TField::access()>, "the field must be writeable");
+    assert(in.size() >= records.size());
+
+    using ops_type = typename TRec::bf_ops;
+    using int_type = typename TRec::value_type;
+    using assignment = field_assignment<TField, TClass>;
+    constexpr auto mask = assignment::template mask<int_type>();
+    const auto positioned = [](const TIn& value)
+    {
+        const assignment item{static_cast<typename TField::value_type>(value)};
+        return item.template positioned<int_type>();
+    };
+    const auto count = records.size();
+    std::size_t i = 0;
+    for (; (i + detail::column_block) <= count; i += detail::column_block)
+    {
+        std::array<int_type, detail::column_block> values;
+        std::array<int_type, detail::column_block> fields;
+        for (std::size_t j = 0; j < detail::column_block; ++j)
+        {
+            fields[j] = positioned(in[i + j]);
+        }
+        for (std::size_t j = 0; j < detail::column_block; ++j)
+        {
+            values[j] = ops_type::get_value(records[i + j]);
+        }
+        for (std::size_t j = 0; j < detail::column_block; ++j)
+        {
+            ops_type::set_value(records[i + j],
+                                static_cast<int_type>((values[j] & ~mask) | fields[j]));
+        }
+    }
+    for (; i < count; ++i)
+    {
+        ops_type::modify_value(records[i], mask, positioned(in[i]));
+    }
+}
+
+} // namespace bitfilled
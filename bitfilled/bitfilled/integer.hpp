@@ -4,8 +4,13 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <cassert>
 #include <concepts>
 #include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include "bitfilled/base_ops.hpp"
 
 namespace bitfilled
@@ -50,6 +55,251 @@ using sized_unsigned_t = typename sized_integer<SIZE>::unsigned_type;
 template <std::size_t SIZE>
 using sized_signed_t = typename sized_integer<SIZE>::signed_type;
 
+namespace detail
+{
+template <std::unsigned_integral T>
+constexpr T byteswap(T value)
+{
+#if __cpp_lib_byteswap
+    return std::byteswap(value);
+#elif defined(__GNUC__)
+    if constexpr (sizeof(T) == 1)
+    {
+        return value;
+    }
+    else if constexpr (sizeof(T) == 2)
+    {
+        return __builtin_bswap16(value);
+    }
+    else if constexpr (sizeof(T) == 4)
+    {
+        return __builtin_bswap32(value);
+    }
+    else
+    {
+        return __builtin_bswap64(value);
+    }
+#else
+    auto repr = std::bit_cast<std::array<sized_unsigned_t<1>, sizeof(T)>>(value);
+    std::reverse(repr.begin(), repr.end());
+    return std::bit_cast<T>(repr);
+#endif
+}
+
+/// @brief  Loads SIZE bytes from memory as a little-endian integer,
+///         using at most two (overlapping) unaligned native loads.
+template <std::size_t SIZE, std::unsigned_integral TWord>
+inline TWord load_le(const sized_unsigned_t<1>* bytes)
+{
+    using chunk = sized_unsigned_t<std::bit_floor(SIZE)>;
+    chunk low;
+    chunk high;
+    std::memcpy(&low, bytes, sizeof(chunk));
+    std::memcpy(&high, bytes + SIZE - sizeof(chunk), sizeof(chunk));
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        low = byteswap(low);
+        high = byteswap(high);
+    }
+    if constexpr (SIZE == sizeof(chunk))
+    {
+        return static_cast<TWord>(low);
+    }
+    else
+    {
+        // the overlapping bytes are equal in both chunks
+        return static_cast<TWord>(static_cast<TWord>(low) |
+                                  (static_cast<TWord>(high) << ((SIZE - sizeof(chunk)) * 8)));
+    }
+}
+
+/// @brief  Stores the low SIZE bytes of an integer to memory in little-endian order,
+///         using at most two (overlapping) unaligned native stores.
+template <std::size_t SIZE, std::unsigned_integral TWord>
+inline void store_le(sized_unsigned_t<1>* bytes, TWord value)
+{
+    using chunk = sized_unsigned_t<std::bit_floor(SIZE)>;
+    auto low = static_cast<chunk>(value);
+    auto high = static_cast<chunk>(value >> ((SIZE - sizeof(chunk)) * 8));
+    if constexpr (std::endian::native == std::endian::big)
+    {
+        low = byteswap(low);
+        high = byteswap(high);
+    }
+    std::memcpy(bytes + SIZE - sizeof(chunk), &high, sizeof(chunk));
+    std::memcpy(bytes, &low, sizeof(chunk));
+}
+
+/// @brief  Whether an integer type exists that holds both SIZE bytes and the T value,
+///         allowing the conversions to use native integer loads and stores.
+template <std::size_t SIZE, typename T>
+inline constexpr bool has_packed_word = (std::max(SIZE, sizeof(T)) <= sizeof(std::uint64_t)) and
+                                        ((std::endian::native == std::endian::little) or
+                                         (std::endian::native == std::endian::big));
+template <std::size_t SIZE, typename T>
+using packed_word_t = sized_unsigned_t<std::bit_ceil(std::max(SIZE, sizeof(T)))>;
+
+/// @brief  Reads an integer from SIZE bytes of the given endianness, with sign extension.
+template <std::size_t SIZE, std::integral T>
+inline T load_packed(const sized_unsigned_t<1>* bytes, std::endian endianness)
+{
+    using word = packed_word_t<SIZE, T>;
+    constexpr auto unused_bits = (sizeof(word) - SIZE) * 8;
+    auto wordval = load_le<SIZE, word>(bytes);
+    if (endianness == std::endian::big)
+    {
+        wordval = static_cast<word>(byteswap(wordval) >> unused_bits);
+    }
+    if constexpr (std::is_signed_v<T> and (unused_bits > 0))
+    {
+        using signed_word = std::make_signed_t<word>;
+        const auto top = static_cast<signed_word>(static_cast<word>(wordval << unused_bits));
+        wordval = static_cast<word>(top >> unused_bits);
+    }
+    return static_cast<T>(wordval);
+}
+
+/// @brief  Writes an integer to SIZE bytes of the given endianness, with sign extension.
+template <std::size_t SIZE, std::integral T>
+inline void store_packed(sized_unsigned_t<1>* bytes, T value, std::endian endianness)
+{
+    using word = packed_word_t<SIZE, T>;
+    constexpr auto unused_bits = (sizeof(word) - SIZE) * 8;
+    auto wordval = static_cast<word>(value);
+    if (endianness == std::endian::big)
+    {
+        wordval = static_cast<word>(byteswap(wordval) >> unused_bits);
+    }
+    store_le<SIZE>(bytes, wordval);
+}
+
+/// @brief  Loads a native word from memory, stored in the given endianness.
+template <std::endian ENDIAN, std::unsigned_integral TWord>
+inline TWord load_word(const sized_unsigned_t<1>* bytes)
+{
+    TWord value;
+    std::memcpy(&value, bytes, sizeof(value));
+    if constexpr (ENDIAN != std::endian::native)
+    {
+        value = byteswap(value);
+    }
+    return value;
+}
+
+/// @brief  Stores a native word to memory in the given endianness.
+template <std::endian ENDIAN, std::unsigned_integral TWord>
+inline void store_word(sized_unsigned_t<1>* bytes, TWord value)
+{
+    if constexpr (ENDIAN != std::endian::native)
+    {
+        value = byteswap(value);
+    }
+    std::memcpy(bytes, &value, sizeof(value));
+}
+
+/// @brief  The packed integers of odd sizes are converted in groups of as many integers
+///         as there are bytes in the native word, as such a group fills exactly SIZE words.
+template <std::size_t SIZE, typename T>
+inline constexpr std::size_t packed_group_size =
+    std::has_single_bit(SIZE) ? 1 : sizeof(packed_word_t<SIZE, T>);
+
+/// @brief  Reads a group of integers from SIZE whole words, sign extending each of them.
+///         The integers are cut out of the adjacent words with constant shifts,
+///         which the compiler can keep in registers and vectorize, unlike the per-integer loads.
+template <std::size_t SIZE, std::integral T, std::endian ENDIAN, typename TOut>
+inline void load_packed_group(const sized_unsigned_t<1>* bytes, TOut* values)
+{
+    using word = packed_word_t<SIZE, T>;
+    using signed_word = std::make_signed_t<word>;
+    constexpr auto word_size = sizeof(word);
+    constexpr auto unused_bits = (word_size - SIZE) * 8;
+    const auto words = [bytes]<std::size_t... J>(std::index_sequence<J...>)
+    {
+        return std::array<word, SIZE>{load_word<ENDIAN, word>(bytes + J * word_size)...};
+    }(std::make_index_sequence<SIZE>{});
+    const auto extract = [&words]<std::size_t OFFSET>()
+    {
+        constexpr auto j = OFFSET / word_size;
+        constexpr auto shift = (OFFSET % word_size) * 8;
+        constexpr bool spills = (OFFSET % word_size) + SIZE > word_size;
+        // align the integer to the top of the word, then shift it back with sign extension
+        word top;
+        if constexpr (ENDIAN == std::endian::big)
+        {
+            top = static_cast<word>(words[j] << shift);
+            if constexpr (spills)
+            {
+                top |= static_cast<word>(words[j + 1] >> (word_size * 8 - shift));
+            }
+        }
+        else
+        {
+            top = static_cast<word>(words[j] >> shift);
+            if constexpr (spills)
+            {
+                top |= static_cast<word>(words[j + 1] << (word_size * 8 - shift));
+            }
+            top = static_cast<word>(top << unused_bits);
+        }
+        if constexpr (std::is_signed_v<T>)
+        {
+            return static_cast<T>(static_cast<signed_word>(top) >> unused_bits);
+        }
+        else
+        {
+            return static_cast<T>(top >> unused_bits);
+        }
+    };
+    [&]<std::size_t... K>(std::index_sequence<K...>)
+    {
+        ((values[K] = static_cast<TOut>(extract.template operator()<K * SIZE>())), ...);
+    }(std::make_index_sequence<packed_group_size<SIZE, T>>{});
+}
+
+/// @brief  Writes a group of integers to SIZE whole words, the inverse of @ref load_packed_group.
+template <std::size_t SIZE, std::integral T, std::endian ENDIAN, typename TIn>
+inline void store_packed_group(sized_unsigned_t<1>* bytes, const TIn* values)
+{
+    using word = packed_word_t<SIZE, T>;
+    constexpr auto word_size = sizeof(word);
+    constexpr auto unused_bits = (word_size - SIZE) * 8;
+    std::array<word, SIZE> words{};
+    const auto insert = [&words]<std::size_t OFFSET>(T value)
+    {
+        constexpr auto j = OFFSET / word_size;
+        constexpr auto shift = (OFFSET % word_size) * 8;
+        constexpr bool spills = (OFFSET % word_size) + SIZE > word_size;
+        // the integer aligned to the top of the word, without the sign extension bits
+        const auto top = static_cast<word>(static_cast<word>(value) << unused_bits);
+        if constexpr (ENDIAN == std::endian::big)
+        {
+            words[j] |= static_cast<word>(top >> shift);
+            if constexpr (spills)
+            {
+                words[j + 1] |= static_cast<word>(top << (word_size * 8 - shift));
+            }
+        }
+        else
+        {
+            const auto bottom = static_cast<word>(top >> unused_bits);
+            words[j] |= static_cast<word>(bottom << shift);
+            if constexpr (spills)
+            {
+                words[j + 1] |= static_cast<word>(bottom >> (word_size * 8 - shift));
+            }
+        }
+    };
+    [&]<std::size_t... K>(std::index_sequence<K...>)
+    {
+        (insert.template operator()<K * SIZE>(static_cast<T>(values[K])), ...);
+    }(std::make_index_sequence<packed_group_size<SIZE, T>>{});
+    [&]<std::size_t... J>(std::index_sequence<J...>)
+    {
+        (store_word<ENDIAN>(bytes + J * word_size, words[J]), ...);
+    }(std::make_index_sequence<SIZE>{});
+}
+} // namespace detail
+
 /// @brief  An array type for flexibly storing an integer value.
 template <std::size_t SIZE>
 struct integer_storage : public std::array<sized_unsigned_t<1>, SIZE>
@@ -67,6 +317,15 @@ struct integer_storage : public std::array<sized_unsigned_t<1>, SIZE>
     constexpr explicit integer_storage(T value, std::endian endianness = std::endian::native)
         : base_type()
     {
+        if constexpr (detail::has_packed_word<SIZE, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::store_packed<SIZE>(this->data(), value, endianness);
+                return;
+            }
+        }
+
         // if the value is signed, fill the target with sign extend bytes
         if (std::is_signed_v<T> and (value < static_cast<T>(0)))
         {
@@ -116,6 +375,14 @@ struct integer_storage : public std::array<sized_unsigned_t<1>, SIZE>
     template <std::integral T>
     [[nodiscard]] constexpr T to_integral(std::endian endianness = std::endian::native) const
     {
+        if constexpr (detail::has_packed_word<SIZE, T>)
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return detail::load_packed<SIZE, T>(this->data(), endianness);
+            }
+        }
+
         integer_storage<sizeof(T)> value_repr;
 
         // if the value is signed, fill the target with sign extend bytes
@@ -167,6 +434,182 @@ struct integer_storage : public std::array<sized_unsigned_t<1>, SIZE>
     }
 };
 
+namespace detail
+{
+/// @brief  The number of bytes covering the bits [FIRST_BIT, LAST_BIT].
+constexpr std::size_t covering_bytes(std::size_t first_bit, std::size_t last_bit)
+{
+    return (last_bit / 8) - (first_bit / 8) + 1;
+}
+
+/// @brief  The packed_field_ops class defines the bitfield operations on packed byte storage,
+///         which access only the storage bytes holding the field's bits (as computed at
+///         compile time from the bit range and the endianness).
+///         The bits are numbered by significance, as if the whole storage was a single integer
+///         of the owner's endianness.
+/// @tparam T: the packed owner type, which provides endianness, size() and data()
+/// @tparam ACCESS
+template <typename T, enum access ACCESS = access::readwrite>
+struct packed_field_ops
+{
+    static constexpr enum access access() { return ACCESS; }
+
+  private:
+    /// @brief  COUNT consecutive bytes of the value, starting from a given significance.
+    template <std::size_t COUNT>
+    struct bytes
+    {
+        static_assert(COUNT <= sizeof(std::uint64_t),
+                      "the field must fit in 8 bytes (fields over 57 bits must be byte aligned)");
+        using word = sized_unsigned_t<std::bit_ceil(COUNT)>;
+
+        /// @brief  The storage index of the lowest addressed byte.
+        /// @param  first: the significance of the least significant byte
+        static constexpr std::size_t index(std::size_t first)
+        {
+            return (T::endianness == std::endian::little) ? first : (T::size() - first - COUNT);
+        }
+        template <typename Tptr>
+        static word load(const Tptr& ptr, std::size_t first)
+        {
+            return load_packed<COUNT, word>(owner_cast<T>(ptr).data() + index(first),
+                                            T::endianness);
+        }
+        template <typename Tptr>
+        static void store(Tptr& ptr, std::size_t first, word value)
+        {
+            store_packed<COUNT>(owner_cast<T>(ptr).data() + index(first), value, T::endianness);
+        }
+    };
+
+    /// @brief  The number of bytes accessed for an item of the set: the bytes of all items
+    ///         when they fit in a word, otherwise the most bytes that a single item covers.
+    template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+    static constexpr std::size_t item_span()
+    {
+        constexpr auto all = covering_bytes(OFFSET, OFFSET + ITEM_SIZE * ITEM_COUNT - 1);
+        if constexpr (all <= sizeof(std::uint64_t))
+        {
+            return all;
+        }
+        else
+        {
+            std::size_t span = 0;
+            for (std::size_t i = 0; i < ITEM_COUNT; ++i)
+            {
+                const auto offset = OFFSET + i * ITEM_SIZE;
+                span = std::max(span, covering_bytes(offset, offset + ITEM_SIZE - 1));
+            }
+            return span;
+        }
+    }
+    /// @brief  The significance of the first byte accessed for the indexed item of the set.
+    template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+    static constexpr std::size_t item_first(std::size_t index)
+    {
+        constexpr auto span = item_span<ITEM_SIZE, ITEM_COUNT, OFFSET>();
+        if constexpr (span == covering_bytes(OFFSET, OFFSET + ITEM_SIZE * ITEM_COUNT - 1))
+        {
+            return OFFSET / 8;
+        }
+        else
+        {
+            // the last items' span is kept within the storage
+            return std::min((OFFSET + index * ITEM_SIZE) / 8, T::size() - span);
+        }
+    }
+
+  public:
+    template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+    static void set_field(bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+        requires(is_writeable<ACCESS>)
+    {
+        static_assert(LAST_BIT < (T::size() * 8), "the field is out of the storage's range");
+        using range = bytes<covering_bytes(FIRST_BIT, LAST_BIT)>;
+        constexpr auto first = FIRST_BIT / 8;
+        using props = bitfield_props<FIRST_BIT - first * 8, LAST_BIT - first * 8>;
+        const auto word = static_cast<typename range::word>(value);
+        range::store(bf, first, props::insert_field(range::load(bf, first), word));
+    }
+    template <typename TVal, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+    static TVal get_field(const bitfield_props<FIRST_BIT, LAST_BIT>& bf)
+        requires(is_readable<ACCESS>)
+    {
+        static_assert(LAST_BIT < (T::size() * 8), "the field is out of the storage's range");
+        using range = bytes<covering_bytes(FIRST_BIT, LAST_BIT)>;
+        constexpr auto first = FIRST_BIT / 8;
+        using props = bitfield_props<FIRST_BIT - first * 8, LAST_BIT - first * 8>;
+        auto typeval = static_cast<TVal>(props::extract_field(range::load(bf, first)));
+        return props::sign_extend(typeval);
+    }
+
+    template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+    static void set_item(regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                         std::size_t index, TVal value)
+        requires(is_writeable<ACCESS>)
+    {
+        static_assert(OFFSET + ITEM_SIZE * ITEM_COUNT <= (T::size() * 8),
+                      "the field set is out of the storage's range");
+        using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+        using range = bytes<item_span<ITEM_SIZE, ITEM_COUNT, OFFSET>()>;
+        using word = typename range::word;
+        const auto first = item_first<ITEM_SIZE, ITEM_COUNT, OFFSET>(index);
+        const auto shift = props::offset(index) - first * 8;
+        const auto mask = static_cast<word>(props::template mask<word>() << shift);
+        const auto bits = static_cast<word>(static_cast<word>(value) << shift);
+        range::store(bf, first,
+                     static_cast<word>((range::load(bf, first) & ~mask) | (bits & mask)));
+    }
+    template <typename TVal, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+    static TVal get_item(const regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                         std::size_t index)
+        requires(is_readable<ACCESS>)
+    {
+        static_assert(OFFSET + ITEM_SIZE * ITEM_COUNT <= (T::size() * 8),
+                      "the field set is out of the storage's range");
+        using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+        using range = bytes<item_span<ITEM_SIZE, ITEM_COUNT, OFFSET>()>;
+        using word = typename range::word;
+        const auto first = item_first<ITEM_SIZE, ITEM_COUNT, OFFSET>(index);
+        const auto shift = props::offset(index) - first * 8;
+        auto typeval = static_cast<TVal>((range::load(bf, first) >> shift) &
+                                         props::template mask<word>());
+        return props::sign_extend(typeval);
+    }
+};
+} // namespace detail
+
+struct bytewise
+{
+    /// @brief  These bitfield operations access only the storage bytes of @ref packed_integer
+    ///         which hold the field's bits, instead of converting the whole integer value.
+    ///         A field within a single byte is thus read with a single byte load,
+    ///         and written with a single byte read-modify-write.
+    ///         The whole value operations convert the entire integer.
+    /// @tparam T: the packed owner type, which provides endianness, size() and data()
+    /// @tparam ACCESS
+    template <typename T, enum access ACCESS = access::readwrite>
+    struct bitfield_ops : private base::bitfield_ops<T, ACCESS>,
+                          private detail::packed_field_ops<T, ACCESS>
+    {
+      private:
+        using base_ops = base::bitfield_ops<T, ACCESS>;
+        using field_ops = detail::packed_field_ops<T, ACCESS>;
+
+      public:
+        using field_ops::access;
+        using int_type = typename base_ops::int_type;
+        using base_ops::get_value;
+        using base_ops::modify_value;
+        using base_ops::set_value;
+
+        using field_ops::get_field;
+        using field_ops::get_item;
+        using field_ops::set_field;
+        using field_ops::set_item;
+    };
+};
+
 /// @brief  packed_integer stores an integer value in a packed byte array, with a defined
 ///         endianness.
 /// @tparam ENDIAN: the endianness to use to convert between the integral value and the underlying
@@ -181,10 +624,11 @@ struct packed_integer
 
   public:
     using superclass = packed_integer;
-    using bf_ops = bitfilled::base::bitfield_ops<packed_integer>;
+    using bf_ops = bitfilled::bytewise::bitfield_ops<packed_integer>;
     using value_type = T;
 
     static constexpr auto endianness = ENDIAN;
+    constexpr static auto size() { return SIZE; }
 
     constexpr packed_integer() : storage() {}
     constexpr packed_integer(value_type value) : storage(value, endianness) {}
@@ -205,10 +649,96 @@ struct packed_integer
     {
         return storage;
     }
+    /// @brief  The storage bytes, in memory order.
+    [[nodiscard]] constexpr sized_unsigned_t<1>* data() { return storage.data(); }
+    [[nodiscard]] constexpr const sized_unsigned_t<1>* data() const { return storage.data(); }
 
     BITFILLED_OPS_FORWARDING
 };
 
+namespace detail
+{
+template <typename TPacked>
+inline constexpr std::size_t packed_size =
+    std::tuple_size_v<std::remove_cvref_t<decltype(std::declval<TPacked&>().as_array())>>;
+} // namespace detail
+
+/// @brief  Converts an array of packed integers to their native integral values.
+/// @param  packed: the packed integers (@ref packed_integer or its subclasses)
+/// @param  values: the destination of the converted values, at least as long as packed
+template <typename TPacked, std::size_t N, std::integral T, std::size_t M>
+void to_native(std::span<TPacked, N> packed, std::span<T, M> values)
+{
+    using packed_type = std::remove_const_t<TPacked>;
+    using value_type = typename packed_type::value_type;
+    constexpr auto size = detail::packed_size<packed_type>;
+    static_assert(sizeof(packed_type) == size, "the packed integers must be contiguous");
+    assert(values.size() >= packed.size());
+
+    const auto count = packed.size();
+    std::size_t i = 0;
+    if constexpr (detail::has_packed_word<size, value_type>)
+    {
+        const auto* bytes = reinterpret_cast<const sized_unsigned_t<1>*>(packed.data());
+        constexpr auto group = detail::packed_group_size<size, value_type>;
+        if constexpr (group > 1)
+        {
+            for (; i + group <= count; i += group)
+            {
+                detail::load_packed_group<size, value_type, packed_type::endianness>(
+                    bytes + i * size, values.data() + i);
+            }
+        }
+        for (; i < count; ++i)
+        {
+            values[i] = static_cast<T>(
+                detail::load_packed<size, value_type>(bytes + i * size, packed_type::endianness));
+        }
+    }
+    for (; i < count; ++i)
+    {
+        values[i] = static_cast<T>(static_cast<value_type>(packed[i]));
+    }
+}
+
+/// @brief  Converts an array of native integral values to packed integers.
+/// @param  values: the values to convert
+/// @param  packed: the destination packed integers (@ref packed_integer or its subclasses),
+///         at least as long as values
+template <std::integral T, std::size_t N, typename TPacked, std::size_t M>
+void from_native(std::span<T, N> values, std::span<TPacked, M> packed)
+{
+    using value_type = typename TPacked::value_type;
+    constexpr auto size = detail::packed_size<TPacked>;
+    static_assert(sizeof(TPacked) == size, "the packed integers must be contiguous");
+    assert(packed.size() >= values.size());
+
+    const auto count = values.size();
+    std::size_t i = 0;
+    if constexpr (detail::has_packed_word<size, value_type>)
+    {
+        auto* bytes = reinterpret_cast<sized_unsigned_t<1>*>(packed.data());
+        constexpr auto group = detail::packed_group_size<size, value_type>;
+        if constexpr (group > 1)
+        {
+            for (; i + group <= count; i += group)
+            {
+                detail::store_packed_group<size, value_type, TPacked::endianness>(
+                    bytes + i * size, values.data() + i);
+            }
+        }
+        for (; i < count; ++i)
+        {
+            detail::store_packed<size>(bytes + i * size, static_cast<value_type>(values[i]),
+                                       TPacked::endianness);
+        }
+    }
+    for (; i < count; ++i)
+    {
+        packed[i] = static_cast<value_type>(values[i]);
+    }
+}
+
 /// @brief  The host_integer class wraps an arithmetic type to allow subclassing it
 ///         (e.g. for the purpose of adding bitfields to it).
 /// @tparam T: the arithmetic type to wrap
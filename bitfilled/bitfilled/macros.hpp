@@ -106,8 +106,49 @@
 /// @param ... Custom bitfield operations when desired (e.g., bitband<PERIPH_BASE>).
 #define BF_MMREG(TYPE, ...) public ::bitfilled::mmreg<TYPE, ::bitfilled::access::__VA_ARGS__>
 
+/// @brief Macro to define a register type of a device behind a bus (see remote.hpp).
+/// @param TYPE The underlying type of the register (e.g., uint8_t).
+/// @param ACCESS The access type (e.g., rw, r, w).
+/// @param ADDRESS The register's address on the device.
+#define BF_REMOTEREG(TYPE, ACCESS, ADDRESS)                                                        \
+    public ::bitfilled::remote_reg<TYPE, ::bitfilled::access::ACCESS, ADDRESS>
+
+/// @brief Macro to define a register type of a device behind a slow bus (see async.hpp).
+/// @param TYPE The underlying type of the register (e.g., uint8_t).
+/// @param ACCESS The access type (e.g., rw, r, w).
+/// @param ADDRESS The register's address on the device.
+#define BF_ASYNCREG(TYPE, ACCESS, ADDRESS)                                                         \
+    public ::bitfilled::async_reg<TYPE, ::bitfilled::access::ACCESS, ADDRESS>
+
 #define BF_MMREG_RESERVED(WIDTH, SIZE)                                                             \
   private:                                                                                         \
     const ::std::array<::bitfilled::sized_unsigned_t<WIDTH>, SIZE> BF_UNIQUE_NAME(_reserved_);     \
                                                                                                    \
   public:
+
+// applies MACRO(ARG, X) to each of the (at most 256) variadic arguments
+#define BF_PARENS ()
+#define BF_EXPAND(...) BF_EXPAND3(BF_EXPAND3(BF_EXPAND3(BF_EXPAND3(__VA_ARGS__))))
+#define BF_EXPAND3(...) BF_EXPAND2(BF_EXPAND2(BF_EXPAND2(BF_EXPAND2(__VA_ARGS__))))
+#define BF_EXPAND2(...) BF_EXPAND1(BF_EXPAND1(BF_EXPAND1(BF_EXPAND1(__VA_ARGS__))))
+#define BF_EXPAND1(...) __VA_ARGS__
+#define BF_FOR_EACH(MACRO, ARG, ...)                                                               \
+    __VA_OPT__(BF_EXPAND(BF_FOR_EACH_HELPER(MACRO, ARG, __VA_ARGS__)))
+#define BF_FOR_EACH_HELPER(MACRO, ARG, X, ...)                                                     \
+    MACRO(ARG, X) __VA_OPT__(BF_FOR_EACH_AGAIN BF_PARENS(MACRO, ARG, __VA_ARGS__))
+#define BF_FOR_EACH_AGAIN() BF_FOR_EACH_HELPER
+
+#define BF_LAYOUT_FIELD(TYPE, NAME) ::bitfilled::make_field_info<&TYPE::NAME>(#NAME),
+
+/// @brief Macro to export the layout metadata of a type for binary logging (see binlog.hpp),
+///        use it in the global namespace, after the type definition.
+/// @param TYPE The qualified name of the register or record type (e.g., periph_t::CTRL_t).
+/// @param ... The names of the bitfield members to export.
+#define BF_LAYOUT(TYPE, ...)                                                                       \
+    template <>                                                                                    \
+    struct bitfilled::layout_info<TYPE>                                                            \
+    {                                                                                              \
+        static constexpr ::std::string_view name = #TYPE;                                          \
+        static constexpr ::std::uint32_t id = ::bitfilled::layout_id(name);                        \
+        static constexpr ::std::array fields{BF_FOR_EACH(BF_LAYOUT_FIELD, TYPE, __VA_ARGS__)};     \
+    }
@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <system_error>
+#include <utility>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace bitfilled
+{
+/// @brief  The mapped_device class maps the registers of a device into the process (on Linux),
+///         from a UIO device (/dev/uioN), a PCI resource file (/sys/bus/pci/devices/.../resourceN)
+///         or any other mappable file descriptor (e.g. a memfd for testing),
+///         and waits for the device's interrupts through the UIO interface.
+///         The mapping is checked once, when the object is created.
+/// @tparam TRegs: the register map type (a struct of @ref mmreg members)
+template <typename TRegs>
+class mapped_device
+{
+  public:
+    using value_type = TRegs;
+
+    /// @brief  The mapping offset of the UIO device's Nth memory map.
+    static std::size_t uio_map_offset(std::size_t map_index)
+    {
+        return map_index * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    }
+
+    mapped_device() = default;
+    /// @brief  Opens and maps the device file.
+    /// @param  path: the device file's path
+    /// @param  offset: the byte offset of the registers in the file (need not be page aligned)
+    explicit mapped_device(const char* path, std::size_t offset = 0)
+        : mapped_device(::open(path, O_RDWR | O_SYNC | O_CLOEXEC), offset)
+    {}
+    /// @brief  Maps the opened file, taking ownership of the file descriptor(s).
+    /// @param  fd: the file descriptor to map
+    /// @param  offset: the byte offset of the registers in the file (need not be page aligned)
+    /// @param  event_fd: the file descriptor delivering the interrupts (when it isn't fd)
+    explicit mapped_device(int fd, std::size_t offset, int event_fd = -1)
+        : fd_(fd), event_fd_(event_fd)
+    {
+        if (fd_ < 0)
+        {
+            error_ = last_error();
+            return;
+        }
+        const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const auto page_offset = offset % page_size;
+        length_ = page_offset + sizeof(TRegs);
+        void* mapping = ::mmap(nullptr, length_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+                               static_cast<off_t>(offset - page_offset));
+        if (mapping == MAP_FAILED)
+        {
+            error_ = last_error();
+            return;
+        }
+        mapping_ = static_cast<std::byte*>(mapping);
+        regs_ = static_cast<volatile TRegs*>(static_cast<void*>(mapping_ + page_offset));
+    }
+    ~mapped_device() { release(); }
+
+    mapped_device(mapped_device&& other) noexcept { *this = std::move(other); }
+    mapped_device& operator=(mapped_device&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            fd_ = std::exchange(other.fd_, -1);
+            event_fd_ = std::exchange(other.event_fd_, -1);
+            mapping_ = std::exchange(other.mapping_, nullptr);
+            length_ = std::exchange(other.length_, 0);
+            regs_ = std::exchange(other.regs_, nullptr);
+            error_ = std::exchange(other.error_, std::error_code());
+        }
+        return *this;
+    }
+    mapped_device(const mapped_device&) = delete;
+    mapped_device& operator=(const mapped_device&) = delete;
+
+    /// @brief  Whether the registers are mapped.
+    explicit operator bool() const { return regs_ != nullptr; }
+    /// @brief  The error of the last failed operation.
+    std::error_code error() const { return error_; }
+
+    volatile TRegs& operator*() const
+    {
+        assert(regs_ != nullptr);
+        return *regs_;
+    }
+    volatile TRegs* operator->() const
+    {
+        assert(regs_ != nullptr);
+        return regs_;
+    }
+
+    /// @brief  Enables or disables the interrupt (UIO drivers implementing irqcontrol).
+    /// @return true if the request was delivered
+    bool enable_interrupt(bool enable = true)
+    {
+        const std::int32_t value = enable ? 1 : 0;
+        ssize_t written;
+        do
+        {
+            written = ::write(interrupt_fd(), &value, sizeof(value));
+        } while ((written < 0) and (errno == EINTR));
+        if (written != sizeof(value))
+        {
+            error_ = transfer_error(written);
+            return false;
+        }
+        return true;
+    }
+
+    /// @brief  Blocks the calling thread until the next interrupt of the device,
+    ///         instead of polling its status registers.
+    /// @param  timeout: the maximal waiting time, negative to wait indefinitely
+    /// @return the total number of the device's interrupts, or nothing on timeout or error
+    std::optional<std::uint32_t> wait_interrupt(
+        std::chrono::milliseconds timeout = std::chrono::milliseconds(-1))
+    {
+        using clock = std::chrono::steady_clock;
+        using std::chrono::milliseconds;
+        const auto deadline = clock::now() + timeout;
+        pollfd request{.fd = interrupt_fd(), .events = POLLIN, .revents = 0};
+        for (;;)
+        {
+            // a signal interrupts the waiting, which continues until the original deadline
+            auto remaining = timeout;
+            if (timeout.count() >= 0)
+            {
+                remaining = std::max(std::chrono::ceil<milliseconds>(deadline - clock::now()),
+                                     milliseconds(0));
+            }
+            const int ready = ::poll(&request, 1, static_cast<int>(remaining.count()));
+            if (ready > 0)
+            {
+                break;
+            }
+            if ((ready < 0) and (errno == EINTR))
+            {
+                continue;
+            }
+            error_ = (ready == 0) ? std::make_error_code(std::errc::timed_out) : last_error();
+            return std::nullopt;
+        }
+        std::uint32_t count{};
+        ssize_t received;
+        do
+        {
+            received = ::read(interrupt_fd(), &count, sizeof(count));
+        } while ((received < 0) and (errno == EINTR));
+        if (received != sizeof(count))
+        {
+            error_ = transfer_error(received);
+            return std::nullopt;
+        }
+        return count;
+    }
+
+  private:
+    static std::error_code last_error() { return {errno, std::system_category()}; }
+    /// @brief  The error of a failed read or write, which may also have transferred
+    ///         less than the 4 bytes of the interrupt count (without setting errno).
+    static std::error_code transfer_error(ssize_t result)
+    {
+        return (result < 0) ? last_error() : std::make_error_code(std::errc::io_error);
+    }
+    int interrupt_fd() const { return (event_fd_ >= 0) ? event_fd_ : fd_; }
+
+    void release()
+    {
+        if (mapping_ != nullptr)
+        {
+            ::munmap(mapping_, length_);
+        }
+        if (event_fd_ >= 0)
+        {
+            ::close(event_fd_);
+        }
+        if (fd_ >= 0)
+        {
+            ::close(fd_);
+        }
+        fd_ = event_fd_ = -1;
+        mapping_ = nullptr;
+        regs_ = nullptr;
+    }
+
+    int fd_{-1};
+    int event_fd_{-1};
+    std::byte* mapping_{};
+    std::size_t length_{};
+    volatile TRegs* regs_{};
+    std::error_code error_{};
+};
+
+} // namespace bitfilled
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include "bitfilled/integer.hpp"
+
+namespace bitfilled
+{
+/// @brief  packed_record stores a packed byte array of any size with a defined endianness,
+///         as the container of bitfields (e.g. a whole protocol header), which may be placed
+///         at any bit position, including across 64-bit boundaries.
+///         Each field access only loads and stores the bytes holding the field's bits.
+///         The bits are numbered by significance, as if the whole record was a single integer
+///         of the given endianness: in a big endian record, the most significant bit
+///         of the first byte is the bit (SIZE * 8 - 1).
+/// @tparam ENDIAN: the endianness of the record
+/// @tparam SIZE: the record size in octets
+template <std::endian ENDIAN, std::size_t SIZE>
+struct packed_record
+{
+    static_assert(SIZE > 0);
+
+  protected:
+    std::array<sized_unsigned_t<1>, SIZE> storage;
+
+  public:
+    using superclass = packed_record;
+    using bf_ops = detail::packed_field_ops<packed_record>;
+
+    static constexpr auto endianness = ENDIAN;
+    constexpr static auto size() { return SIZE; }
+
+    constexpr packed_record() : storage() {}
+    // NOLINTNEXTLINE
+    constexpr explicit packed_record(const sized_unsigned_t<1> (&arr)[SIZE]) : storage()
+    {
+        std::copy(std::begin(arr), std::end(arr), storage.begin());
+    }
+
+    [[nodiscard]] constexpr std::array<sized_unsigned_t<1>, SIZE> to_array() { return storage; }
+    [[nodiscard]] constexpr const std::array<sized_unsigned_t<1>, SIZE>& as_array() const
+    {
+        return storage;
+    }
+    /// @brief  The storage bytes, in memory order.
+    [[nodiscard]] constexpr sized_unsigned_t<1>* data() { return storage.data(); }
+    [[nodiscard]] constexpr const sized_unsigned_t<1>* data() const { return storage.data(); }
+
+    BITFILLED_OPS_FORWARDING
+};
+
+} // namespace bitfilled
@@ -0,0 +1,343 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <vector>
+#include "bitfilled/base_ops.hpp"
+#include "bitfilled/integer.hpp"
+
+namespace bitfilled
+{
+/// @brief  The register_transport class is the interface of the bus (I2C, SPI, ...)
+///         which carries the register accesses of a @ref remote_device.
+///         Each transaction accesses consecutive bytes, starting at the given register address
+///         (using the device's address auto-increment for bursts).
+class register_transport
+{
+  public:
+    virtual ~register_transport() = default;
+
+    /// @brief  Reads data.size() bytes, starting at the register address.
+    virtual std::error_code read(std::uint32_t address, std::span<std::byte> data) = 0;
+    /// @brief  Writes data.size() bytes, starting at the register address.
+    virtual std::error_code write(std::uint32_t address, std::span<const std::byte> data) = 0;
+};
+
+class remote_batch;
+
+namespace detail
+{
+/// @brief  The remote_bus class is the common part of the @ref remote_device types,
+///         which the registers find at their own address.
+class remote_bus
+{
+  public:
+    remote_bus(register_transport& transport, std::endian endianness)
+        : transport_(&transport), endianness_(endianness)
+    {}
+    remote_bus(const remote_bus&) = delete;
+    remote_bus& operator=(const remote_bus&) = delete;
+
+    /// @brief  Whether all bus transactions succeeded since the last clear_error().
+    explicit operator bool() const { return !error_; }
+    /// @brief  The error of the last failed bus transaction.
+    std::error_code error() const { return error_; }
+    void clear_error() { error_ = {}; }
+    /// @brief  The byte order of the multi-byte registers on the bus.
+    std::endian endianness() const { return endianness_; }
+    register_transport& transport() const { return *transport_; }
+
+    /// @brief  The bus of the register, which is located at the address of its device.
+    static remote_bus& of(const void* reg)
+    {
+        return *const_cast<remote_bus*>(static_cast<const remote_bus*>(reg));
+    }
+
+    template <typename T>
+    T read(std::uint32_t address);
+    template <typename T>
+    void write(std::uint32_t address, T value);
+
+    std::error_code transport_read(std::uint32_t address, std::span<std::byte> data)
+    {
+        const auto error = transport_->read(address, data);
+        if (error)
+        {
+            error_ = error;
+            std::fill(data.begin(), data.end(), std::byte{});
+        }
+        return error;
+    }
+    std::error_code transport_write(std::uint32_t address, std::span<const std::byte> data)
+    {
+        const auto error = transport_->write(address, data);
+        if (error)
+        {
+            error_ = error;
+        }
+        return error;
+    }
+
+  private:
+    friend class bitfilled::remote_batch;
+
+    register_transport* transport_;
+    std::endian endianness_;
+    std::error_code error_{};
+    remote_batch* batch_{};
+};
+} // namespace detail
+
+/// @brief  The remote_batch class merges the register accesses of a @ref remote_device
+///         into burst transactions, while it is in scope:
+///         - consecutive writes to contiguous registers are sent as a single burst write,
+///           when the batch is flushed (at the latest, when it is destroyed),
+///         - prefetch() reads a range of contiguous registers with a single burst read,
+///           and the register reads within the range are served from the fetched bytes
+///           (which the writes of the batch update).
+///         Any other register read flushes the pending writes before it, to keep the order
+///         of the bus transactions. A batch is meant to be used by a single thread.
+class remote_batch
+{
+  public:
+    template <typename TDevice>
+    explicit remote_batch(TDevice& device) : bus_(device), previous_(bus_.batch_)
+    {
+        if (previous_ != nullptr)
+        {
+            // the writes of the enclosing batch come first
+            previous_->flush();
+        }
+        bus_.batch_ = this;
+    }
+    ~remote_batch()
+    {
+        flush();
+        bus_.batch_ = previous_;
+    }
+    remote_batch(const remote_batch&) = delete;
+    remote_batch& operator=(const remote_batch&) = delete;
+
+    /// @brief  Reads the registers from first to last (inclusive) with a single burst read.
+    ///         e.g. batch.prefetch(device.STATUS, device.COUNT)
+    template <typename TFirst, typename TLast>
+    void prefetch(const TFirst&, const TLast&)
+    {
+        static_assert(TFirst::address() <= TLast::address());
+        prefetch(TFirst::address(), TLast::address() + TLast::size() - TFirst::address());
+    }
+    /// @brief  Reads the byte range of registers with a single burst read.
+    void prefetch(std::uint32_t address, std::size_t size)
+    {
+        flush();
+        range fetched{address, std::vector<std::byte>(size)};
+        bus_.transport_read(address, fetched.bytes);
+        std::erase_if(fetched_, [&](const range& r) { return r.overlaps(address, size); });
+        fetched_.push_back(std::move(fetched));
+    }
+
+    /// @brief  Sends the pending writes.
+    void flush()
+    {
+        for (const auto& run : pending_)
+        {
+            bus_.transport_write(run.address, run.bytes);
+        }
+        pending_.clear();
+    }
+
+    /// @brief  Reads the bytes of a register, from the prefetched ranges or from the bus.
+    void read(std::uint32_t address, std::span<std::byte> data)
+    {
+        for (const auto& r : fetched_)
+        {
+            if (r.contains(address, data.size()))
+            {
+                std::copy_n(r.bytes.begin() + (address - r.address), data.size(), data.begin());
+                return;
+            }
+        }
+        flush();
+        bus_.transport_read(address, data);
+    }
+    /// @brief  Queues the write of a register, merged with the previous write if they are
+    ///         contiguous.
+    void write(std::uint32_t address, std::span<const std::byte> data)
+    {
+        for (auto& r : fetched_)
+        {
+            if (r.contains(address, data.size()))
+            {
+                std::copy(data.begin(), data.end(), r.bytes.begin() + (address - r.address));
+            }
+        }
+        if (!pending_.empty() and (pending_.back().end() == address))
+        {
+            auto& bytes = pending_.back().bytes;
+            bytes.insert(bytes.end(), data.begin(), data.end());
+            return;
+        }
+        pending_.push_back(range{address, std::vector<std::byte>(data.begin(), data.end())});
+    }
+
+  private:
+    struct range
+    {
+        std::uint32_t address;
+        std::vector<std::byte> bytes;
+
+        std::uint32_t end() const { return address + static_cast<std::uint32_t>(bytes.size()); }
+        bool contains(std::uint32_t first, std::size_t size) const
+        {
+            return (first >= address) and ((first + size) <= end());
+        }
+        bool overlaps(std::uint32_t first, std::size_t size) const
+        {
+            return (first < end()) and ((first + size) > address);
+        }
+    };
+
+    detail::remote_bus& bus_;
+    remote_batch* previous_;
+    std::vector<range> fetched_{};
+    std::vector<range> pending_{};
+};
+
+namespace detail
+{
+template <typename T>
+T remote_bus::read(std::uint32_t address)
+{
+    integer_storage<sizeof(T)> bytes{};
+    const auto data = std::as_writable_bytes(std::span{bytes});
+    if (batch_ != nullptr)
+    {
+        batch_->read(address, data);
+    }
+    else
+    {
+        transport_read(address, data);
+    }
+    return bytes.template to_integral<T>(endianness_);
+}
+template <typename T>
+void remote_bus::write(std::uint32_t address, T value)
+{
+    const integer_storage<sizeof(T)> bytes{value, endianness_};
+    const auto data = std::as_bytes(std::span{bytes});
+    if (batch_ != nullptr)
+    {
+        batch_->write(address, data);
+    }
+    else
+    {
+        transport_write(address, data);
+    }
+}
+} // namespace detail
+
+/// @brief  remote_device is the base of the register map of a device behind a bus
+///         (a struct of @ref remote_reg members), which binds the registers to the transport.
+///         The registers are empty objects, which find the transport at the address
+///         of the device, therefore they must be declared [[no_unique_address]].
+/// @tparam TDevice: the register map type (CRTP)
+template <typename TDevice>
+struct remote_device : public detail::remote_bus
+{
+    /// @param  transport: the bus transport to the device
+    /// @param  endianness: the byte order of the multi-byte registers on the bus
+    explicit remote_device(register_transport& transport,
+                           std::endian endianness = std::endian::big)
+        : remote_bus(transport, endianness)
+    {
+        static_assert(sizeof(TDevice) == sizeof(detail::remote_bus),
+                      "the registers must be [[no_unique_address]] members of distinct types");
+    }
+};
+
+/// @brief  remote_reg represents a register of a device behind a bus (@ref remote_device),
+///         whose whole value accesses are bus transactions.
+/// @tparam T: the register's integral type
+/// @tparam ACCESS: the access type of the register
+/// @tparam ADDRESS: the register's address on the device
+template <Integral T, enum access ACCESS, std::uint32_t ADDRESS>
+struct remote_reg
+{
+    using superclass = remote_reg;
+    using value_type = T;
+    using bf_ops = base::bitfield_ops<remote_reg, ACCESS>;
+
+    static constexpr enum access access() { return ACCESS; }
+    static constexpr std::uint32_t address() { return ADDRESS; }
+    constexpr static auto size() { return sizeof(T); }
+
+    remote_reg() = default;
+    ~remote_reg() = default;
+    remote_reg(const remote_reg&) = delete;
+    remote_reg& operator=(const remote_reg&) = delete;
+
+    operator T() const
+        requires(is_readable<ACCESS>)
+    {
+        return detail::remote_bus::of(this).template read<T>(ADDRESS);
+    }
+    void operator=(T value)
+        requires(is_writeable<ACCESS>)
+    {
+        detail::remote_bus::of(this).write(ADDRESS, value);
+    }
+
+    BITFILLED_OPS_FORWARDING
+};
+
+/// @brief  The loopback_transport class is a register file in host memory, standing in
+///         for a remote device in tests. It records the transactions it carries.
+class loopback_transport : public register_transport
+{
+  public:
+    struct transaction
+    {
+        bool write;
+        std::uint32_t address;
+        std::size_t size;
+    };
+
+    explicit loopback_transport(std::size_t size) : memory_(size) {}
+
+    std::error_code read(std::uint32_t address, std::span<std::byte> data) override
+    {
+        log_.push_back({false, address, data.size()});
+        if ((address + data.size()) > memory_.size())
+        {
+            return std::make_error_code(std::errc::bad_address);
+        }
+        std::copy_n(memory_.begin() + address, data.size(), data.begin());
+        return {};
+    }
+    std::error_code write(std::uint32_t address, std::span<const std::byte> data) override
+    {
+        log_.push_back({true, address, data.size()});
+        if ((address + data.size()) > memory_.size())
+        {
+            return std::make_error_code(std::errc::bad_address);
+        }
+        std::copy(data.begin(), data.end(), memory_.begin() + address);
+        return {};
+    }
+
+    /// @brief  The contents of the register file.
+    std::span<std::byte> memory() { return memory_; }
+    /// @brief  The transactions carried since the last clear_log().
+    const std::vector<transaction>& log() const { return log_; }
+    void clear_log() { log_.clear(); }
+
+  private:
+    std::vector<std::byte> memory_;
+    std::vector<transaction> log_{};
+};
+
+} // namespace bitfilled
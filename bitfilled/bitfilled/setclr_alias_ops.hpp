@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <cstddef>
+#include "bitfilled/transaction.hpp"
+
+namespace bitfilled
+{
+/// @tparam SET_OFFSET: the byte offset of the register's set alias (writing 1 sets the bit)
+/// @tparam CLR_OFFSET: the byte offset of the register's clear alias (writing 1 clears the bit)
+/// @tparam TGL_OFFSET: the byte offset of the register's toggle alias (writing 1 inverts the bit)
+template <std::ptrdiff_t SET_OFFSET, std::ptrdiff_t CLR_OFFSET, std::ptrdiff_t TGL_OFFSET>
+struct setclr_alias
+{
+    /// @brief  These bitfield operations write the fields through the set, clear and toggle
+    ///         aliases of the register (e.g. NXP i.MX: 4, 8, 12; Microchip PIC32: 8, 4, 12;
+    ///         RP2040: 0x2000, 0x3000, 0x1000), so that no read-modify-write cycle is needed:
+    ///         the field's bits to clear are written to the clear alias, then its bits to set
+    ///         to the set alias. Single bit fields are written with a single store.
+    /// @note   These operations shall only be used on types that map directly to memory
+    ///         ( @ref host_integer and @ref mmreg )
+    /// @tparam T
+    /// @tparam ACCESS
+    template <typename T, enum access ACCESS = access::readwrite>
+    struct bitfield_ops : private base::bitfield_ops<T, ACCESS>
+    {
+      private:
+        using base_ops = base::bitfield_ops<T, ACCESS>;
+
+      public:
+        using base_ops::access;
+        using int_type = typename base_ops::int_type;
+        using base_ops::get_value;
+        using base_ops::set_value;
+
+      private:
+        template <std::ptrdiff_t OFFSET, typename Tptr>
+        static void store(Tptr& ptr, int_type bits)
+        {
+            using byte_type = std::remove_reference_t<copy_cv_t<Tptr&, std::byte>>;
+            using void_type = std::remove_reference_t<copy_cv_t<Tptr&, void>>;
+            using int_pointer = std::remove_reference_t<copy_cv_t<Tptr&, int_type>>*;
+            auto* alias = static_cast<byte_type*>(static_cast<void_type*>(&ptr)) + OFFSET;
+            // the alias registers are aligned the same way as the register
+            *static_cast<int_pointer>(static_cast<void_type*>(alias)) = bits;
+        }
+        template <typename Tptr>
+        static void update(Tptr& ptr, int_type mask, int_type value)
+        {
+            const auto set_bits = static_cast<int_type>(value & mask);
+            const auto clr_bits = static_cast<int_type>(~value & mask);
+            if (clr_bits != 0)
+            {
+                store<CLR_OFFSET>(ptr, clr_bits);
+            }
+            if (set_bits != 0)
+            {
+                store<SET_OFFSET>(ptr, set_bits);
+            }
+        }
+
+      public:
+        /// @brief  Replaces the masked bits of the owner with (at most) a clear and a set alias
+        ///         store, without reading it.
+        template <typename Tptr>
+        static void modify_value(Tptr& ptr, int_type mask, int_type value)
+            requires(is_writeable<ACCESS>)
+        {
+            update(ptr, mask, value);
+        }
+        /// @brief  Inverts the masked bits of the owner with a single toggle alias store.
+        template <typename Tptr>
+        static void toggle_value(Tptr& ptr, int_type mask)
+            requires(is_writeable<ACCESS>)
+        {
+            store<TGL_OFFSET>(ptr, mask);
+        }
+
+        template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+        static void set_field(bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            using props = bitfield_props<FIRST_BIT, LAST_BIT>;
+            update(bf, static_cast<int_type>(props::template mask<int_type>() << FIRST_BIT),
+                   props::position_field(static_cast<int_type>(value)));
+        }
+        template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+        static void set_field(volatile bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            using props = bitfield_props<FIRST_BIT, LAST_BIT>;
+            update(bf, static_cast<int_type>(props::template mask<int_type>() << FIRST_BIT),
+                   props::position_field(static_cast<int_type>(value)));
+        }
+        using base_ops::get_field;
+
+        template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+        static void set_item(regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+            update(bf,
+                   static_cast<int_type>(props::template mask<int_type>() << props::offset(index)),
+                   props::position_field(static_cast<int_type>(value), index));
+        }
+        template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+        static void set_item(volatile regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            using props = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+            update(bf,
+                   static_cast<int_type>(props::template mask<int_type>() << props::offset(index)),
+                   props::position_field(static_cast<int_type>(value), index));
+        }
+        using base_ops::get_item;
+    };
+};
+
+/// @brief  The fields are written with stores to the clear and set aliases.
+template <std::ptrdiff_t SET_OFFSET, std::ptrdiff_t CLR_OFFSET, std::ptrdiff_t TGL_OFFSET>
+struct write_traits<setclr_alias<SET_OFFSET, CLR_OFFSET, TGL_OFFSET>>
+{
+    static constexpr bool stores_field(std::size_t) { return true; }
+    static constexpr bool stores_modify() { return true; }
+};
+
+/// @brief  Inverts the given fields of the owner with a single store to its toggle alias.
+/// @param  reg: the owner object, with @ref setclr_alias operations
+/// @param  members: the bitfield member pointers
+template <typename TReg, typename... TClasses, typename... TFields>
+void toggle(TReg& reg, [[maybe_unused]] TFields TClasses::*... members)
+{
+    using ops_type = typename std::remove_cv_t<TReg>::bf_ops;
+    using int_type = typename std::remove_cv_t<TReg>::value_type;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the toggled object");
+    static_assert((is_writeable<TFields::access()> and ...), "the fields must be writeable");
+
+    ops_type::toggle_value(reg, detail::fields_mask<int_type, TFields...>());
+}
+
+} // namespace bitfilled
@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include "bitfilled/base_ops.hpp"
+
+namespace bitfilled
+{
+/// @tparam TKey: a type that is unique to the register (e.g. the register type itself),
+///         which selects the register's own shadow. Each instance of a peripheral's register
+///         needs its own key, as the shadow is not looked up by address.
+/// @tparam TOps: the operations to access the register with (e.g. @ref base or @ref bitband)
+template <typename TKey, typename TOps = base>
+struct shadowed
+{
+    /// @brief  These bitfield operations keep a RAM copy (shadow) of the last value written
+    ///         to the register, and perform the read-modify-write of fields on the shadow,
+    ///         followed by a single write of the whole register.
+    ///         This allows partial updates of write-only registers, without clearing
+    ///         the other fields of the register.
+    /// @note   The shadow is only kept up to date when the register is written through
+    ///         these operations (i.e. fields, @ref modify, or set_value() ), and it starts as zero.
+    ///         Like the read-modify-write of a readable register, concurrent writes of
+    ///         the same register must be serialized by the caller.
+    /// @tparam T
+    /// @tparam ACCESS
+    template <typename T, enum access ACCESS = access::readwrite>
+    struct bitfield_ops : private TOps::template bitfield_ops<T, ACCESS>
+    {
+        using int_type = typename T::value_type;
+
+      private:
+        using base_ops = typename TOps::template bitfield_ops<T, ACCESS>;
+        static_assert(!is_ephemeralwrite<ACCESS>, "ephemeral writes cannot be shadowed");
+
+        // T is the register's base type, which TKey makes unique to the register
+        static inline int_type shadow_{};
+
+        template <typename Tptr>
+        static void store(Tptr& ptr, int_type value)
+        {
+            shadow_ = value;
+            base_ops::set_value(ptr, value);
+        }
+
+      public:
+        static constexpr enum access access() { return ACCESS; }
+        using base_ops::get_value;
+
+        /// @brief  Reads the last written value of the register, without accessing it.
+        template <typename Tptr>
+        static int_type shadow(const Tptr&)
+        {
+            return shadow_;
+        }
+
+        template <typename Tptr>
+        static void set_value(Tptr& ptr, int_type value)
+            requires(is_writeable<ACCESS>)
+        {
+            store(ptr, value);
+        }
+        template <typename Tptr>
+        static void modify_value(Tptr& ptr, int_type mask, int_type value)
+            requires(is_writeable<ACCESS>)
+        {
+            store(ptr, static_cast<int_type>((shadow_ & ~mask) | (value & mask)));
+        }
+
+        template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+        static void set_field(bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            const auto intval = static_cast<int_type>(value);
+            store(bf, bf.insert_field(shadow_, intval));
+        }
+        template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+        static void set_field(volatile bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            const auto intval = static_cast<int_type>(value);
+            store(bf, bf.insert_field(shadow_, intval));
+        }
+        template <typename TVal, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+        static TVal get_field(const bitfield_props<FIRST_BIT, LAST_BIT>& bf)
+            requires(is_readable<ACCESS>)
+        {
+            return base_ops::template get_field<TVal>(bf);
+        }
+        template <typename TVal, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+        static TVal get_field(const volatile bitfield_props<FIRST_BIT, LAST_BIT>& bf)
+            requires(is_readable<ACCESS>)
+        {
+            return base_ops::template get_field<TVal>(bf);
+        }
+
+        template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+        static void set_item(regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            const auto intval = static_cast<int_type>(value);
+            store(bf, bf.insert_field(shadow_, intval, index));
+        }
+        template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+        static void set_item(volatile regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            const auto intval = static_cast<int_type>(value);
+            store(bf, bf.insert_field(shadow_, intval, index));
+        }
+        template <typename TVal, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+        static TVal get_item(const regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index)
+            requires(is_readable<ACCESS>)
+        {
+            return base_ops::template get_item<TVal>(bf, index);
+        }
+        template <typename TVal, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+        static TVal get_item(const volatile regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index)
+            requires(is_readable<ACCESS>)
+        {
+            return base_ops::template get_item<TVal>(bf, index);
+        }
+    };
+};
+
+/// @brief  The fields are merged into the shadow, then the whole register is stored.
+template <typename TKey, typename TOps>
+struct write_traits<shadowed<TKey, TOps>>
+{
+    static constexpr bool stores_field(std::size_t) { return true; }
+    static constexpr bool stores_modify() { return true; }
+};
+
+} // namespace bitfilled
@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+#include "bitfilled/base_ops.hpp"
+
+namespace bitfilled
+{
+/// @brief  The simulator class stands in for the peripheral bus of the @ref simulated registers:
+///         registers with an attached model have their reads and writes passed to the model,
+///         the other registers behave as plain memory.
+///         The simulator is active on the thread that constructs it, from its construction
+///         to its destruction, so that tests running on other threads don't share it.
+class simulator
+{
+  public:
+    /// @brief  The behavior of a single register. Both functions receive the stored value of
+    ///         the register (its memory contents), which they may modify (e.g. clear on read).
+    ///         An empty function behaves as plain memory.
+    struct model
+    {
+        /// @brief  Returns the value that the driver reads.
+        std::function<std::uint64_t(std::uint64_t& stored)> read{};
+        /// @brief  Processes the value that the driver writes.
+        std::function<void(std::uint64_t& stored, std::uint64_t value)> write{};
+    };
+
+    simulator() : previous_(active_) { active_ = this; }
+    ~simulator() { active_ = previous_; }
+    simulator(const simulator&) = delete;
+    simulator& operator=(const simulator&) = delete;
+
+    /// @brief  The simulator that is currently in effect on this thread, or nullptr.
+    static simulator* active() { return active_; }
+
+    /// @brief  Passes the accesses of the register to the model.
+    template <typename TRegister>
+    void attach(const volatile TRegister& reg, model behavior)
+    {
+        const auto* address = reinterpret_cast<const volatile std::byte*>(&reg);
+        const auto it = std::lower_bound(models_.begin(), models_.end(), address,
+                                         [](const entry& e, auto* a) { return e.address < a; });
+        assert(((it == models_.end()) or (it->address != address)) && "register already attached");
+        models_.insert(it, entry{address, sizeof(typename TRegister::value_type),
+                                 std::move(behavior)});
+    }
+
+    /// @brief  Places the memory (e.g. a peripheral's register map) at the given bus address,
+    ///         which is needed by the operations that depend on the bus address (@ref bitband).
+    void map(const volatile void* memory, std::size_t size, std::uintptr_t bus_address)
+    {
+        regions_.push_back(
+            region{static_cast<const volatile std::byte*>(memory), size, bus_address});
+    }
+
+    /// @brief  The bus address of the mapped memory.
+    static std::uintptr_t bus_address(const volatile void* memory)
+    {
+        const auto* address = static_cast<const volatile std::byte*>(memory);
+        for (const auto& r : current().regions_)
+        {
+            if ((address >= r.memory) and (address < (r.memory + r.size)))
+            {
+                return r.bus_address + static_cast<std::uintptr_t>(address - r.memory);
+            }
+        }
+        // the memory isn't mapped to the bus, its bus address is meaningless
+        std::abort();
+    }
+
+    template <typename TInt>
+    static TInt read(const volatile void* memory)
+    {
+        if (const auto* e = find(memory))
+        {
+            return static_cast<TInt>(active_->read(*e));
+        }
+        return *static_cast<const volatile TInt*>(memory);
+    }
+    template <typename TInt>
+    static void write(const volatile void* memory, TInt value)
+    {
+        if (const auto* e = find(memory))
+        {
+            active_->write(*e, static_cast<std::make_unsigned_t<TInt>>(value));
+            return;
+        }
+        *const_cast<volatile TInt*>(static_cast<const volatile TInt*>(memory)) = value;
+    }
+
+    /// @brief  Reads the bit which the Cortex-M bit-band alias address refers to.
+    static std::uint32_t read_bitband(std::uintptr_t alias_address)
+    {
+        const auto bit = current().bitband_target(alias_address);
+        if (bit.reg != nullptr)
+        {
+            return (active_->read(*bit.reg) >> bit.index) & 1;
+        }
+        return (static_cast<unsigned>(*bit.byte) >> bit.index) & 1;
+    }
+    /// @brief  Writes the bit which the Cortex-M bit-band alias address refers to,
+    ///         with a read-modify-write of the register (or byte) containing it.
+    static void write_bitband(std::uintptr_t alias_address, std::uint32_t value)
+    {
+        const auto bit = current().bitband_target(alias_address);
+        if (bit.reg != nullptr)
+        {
+            const auto mask = std::uint64_t{1} << bit.index;
+            const auto stored = active_->read(*bit.reg);
+            active_->write(*bit.reg, (value & 1) ? (stored | mask) : (stored & ~mask));
+            return;
+        }
+        const auto mask = static_cast<unsigned>(1u << bit.index);
+        auto* byte = const_cast<volatile std::byte*>(bit.byte);
+        const auto stored = static_cast<unsigned>(*byte);
+        *byte = static_cast<std::byte>((value & 1) ? (stored | mask) : (stored & ~mask));
+    }
+
+  private:
+    struct entry
+    {
+        const volatile std::byte* address;
+        std::size_t width;
+        model behavior;
+    };
+    struct region
+    {
+        const volatile std::byte* memory;
+        std::size_t size;
+        std::uintptr_t bus_address;
+    };
+    struct bit_location
+    {
+        const entry* reg;
+        const volatile std::byte* byte;
+        std::size_t index;
+    };
+
+    /// @brief  The active simulator, which the bus address dependent accesses require.
+    static simulator& current()
+    {
+        if (active_ == nullptr)
+        {
+            // there is no simulated bus to translate the address on
+            std::abort();
+        }
+        return *active_;
+    }
+
+    static const entry* find(const volatile void* memory)
+    {
+        if ((active_ == nullptr) or active_->models_.empty())
+        {
+            return nullptr;
+        }
+        const auto* address = static_cast<const volatile std::byte*>(memory);
+        const auto& models = active_->models_;
+        const auto it = std::lower_bound(models.begin(), models.end(), address,
+                                         [](const entry& e, auto* a) { return e.address < a; });
+        return ((it != models.end()) and (it->address == address)) ? &*it : nullptr;
+    }
+
+    template <typename TInt>
+    static volatile TInt& memory_at(const volatile std::byte* address)
+    {
+        // the registers are aligned to their width
+        return *const_cast<volatile TInt*>(
+            static_cast<const volatile TInt*>(static_cast<const volatile void*>(address)));
+    }
+    static std::uint64_t load(const volatile std::byte* address, std::size_t width)
+    {
+        switch (width)
+        {
+        case 1:
+            return memory_at<std::uint8_t>(address);
+        case 2:
+            return memory_at<std::uint16_t>(address);
+        case 4:
+            return memory_at<std::uint32_t>(address);
+        default:
+            return memory_at<std::uint64_t>(address);
+        }
+    }
+    static void store(const volatile std::byte* address, std::size_t width, std::uint64_t value)
+    {
+        switch (width)
+        {
+        case 1:
+            memory_at<std::uint8_t>(address) = static_cast<std::uint8_t>(value);
+            break;
+        case 2:
+            memory_at<std::uint16_t>(address) = static_cast<std::uint16_t>(value);
+            break;
+        case 4:
+            memory_at<std::uint32_t>(address) = static_cast<std::uint32_t>(value);
+            break;
+        default:
+            memory_at<std::uint64_t>(address) = value;
+            break;
+        }
+    }
+    static std::uint64_t truncate(std::uint64_t value, std::size_t width)
+    {
+        return (width < sizeof(value)) ? (value & ((std::uint64_t{1} << (width * 8)) - 1)) : value;
+    }
+
+    std::uint64_t read(const entry& e) const
+    {
+        auto stored = load(e.address, e.width);
+        if (!e.behavior.read)
+        {
+            return stored;
+        }
+        const auto value = e.behavior.read(stored);
+        store(e.address, e.width, truncate(stored, e.width));
+        return truncate(value, e.width);
+    }
+    void write(const entry& e, std::uint64_t value) const
+    {
+        if (!e.behavior.write)
+        {
+            store(e.address, e.width, value);
+            return;
+        }
+        auto stored = load(e.address, e.width);
+        e.behavior.write(stored, value);
+        store(e.address, e.width, truncate(stored, e.width));
+    }
+
+    /// @brief  Translates the bit-band alias address to the simulated memory, and finds
+    ///         the register with a model that contains the bit, if any.
+    bit_location bitband_target(std::uintptr_t alias_address) const
+    {
+        // alias = region base | 0x02000000 | (byte offset << 5) | (bit << 2)
+        const std::uintptr_t bit_offset = (alias_address & 0x01ffffff) >> 2;
+        const std::uintptr_t bus_address = (alias_address & 0xf0000000) + (bit_offset / 8);
+        const volatile std::byte* byte = nullptr;
+        for (const auto& r : regions_)
+        {
+            if ((bus_address >= r.bus_address) and (bus_address < (r.bus_address + r.size)))
+            {
+                byte = r.memory + (bus_address - r.bus_address);
+                break;
+            }
+        }
+        if (byte == nullptr)
+        {
+            // the bit-band alias isn't mapped to simulated memory
+            std::abort();
+        }
+
+        const auto it = std::upper_bound(models_.begin(), models_.end(), byte,
+                                         [](auto* b, const entry& e) { return b < e.address; });
+        if (it != models_.begin())
+        {
+            const auto& e = *std::prev(it);
+            if (byte < (e.address + e.width))
+            {
+                return bit_location{&e, byte,
+                                    static_cast<std::size_t>(byte - e.address) * 8 +
+                                        (bit_offset % 8)};
+            }
+        }
+        return bit_location{nullptr, byte, bit_offset % 8};
+    }
+
+    static inline thread_local simulator* active_{};
+    simulator* previous_;
+    std::vector<entry> models_{};
+    std::vector<region> regions_{};
+};
+
+namespace detail
+{
+/// @brief  The simulated_register class takes the place of the owner type in the operations,
+///         and routes its whole value accesses through the @ref simulator.
+///         It has no storage, its address is the address of the actual register.
+template <typename T>
+struct simulated_register
+{
+    using value_type = typename T::value_type;
+
+    operator value_type() const { return simulator::read<value_type>(this); }
+    operator value_type() const volatile { return simulator::read<value_type>(this); }
+    void operator=(value_type value) { simulator::write<value_type>(this, value); }
+    void operator=(value_type value) volatile { simulator::write<value_type>(this, value); }
+
+    // the register's location is redirected from the bus to the simulated memory
+    static std::uintptr_t bus_address(const volatile void* memory)
+    {
+        return simulator::bus_address(memory);
+    }
+    static std::uint32_t read_bitband(std::uintptr_t alias_address)
+    {
+        return simulator::read_bitband(alias_address);
+    }
+    static void write_bitband(std::uintptr_t alias_address, std::uint32_t value)
+    {
+        simulator::write_bitband(alias_address, value);
+    }
+};
+} // namespace detail
+
+/// @brief  The simulated operations perform the operations of TOps on the host,
+///         with every register access passed to the active @ref simulator
+///         (or to plain memory, when there is none).
+/// @note   Only the accesses made by the operations (fields, @ref modify and @ref read)
+///         are simulated, assigning or converting the whole register accesses its memory directly.
+/// @tparam TOps: the operations to simulate (e.g. @ref base or @ref bitband)
+template <typename TOps = base>
+struct simulated
+{
+    template <typename T, enum access ACCESS = access::readwrite>
+    using bitfield_ops =
+        typename TOps::template bitfield_ops<detail::simulated_register<T>, ACCESS>;
+};
+
+} // namespace bitfilled
@@ -0,0 +1,313 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdio>
+#include "bitfilled/base_ops.hpp"
+
+// setting BITFILLED_TRACE to 0 turns traced<TOps> into TOps, removing the tracing completely
+#ifndef BITFILLED_TRACE
+#define BITFILLED_TRACE 1
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif !(defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))) && !defined(__aarch64__)
+#include <chrono>
+#endif
+
+namespace bitfilled
+{
+enum class trace_kind : std::uint8_t
+{
+    read = 0,
+    write = 1,
+    modify = 2, // read-modify-write
+};
+
+/// @brief  A single register operation, as recorded by the @ref traced operations.
+struct trace_record
+{
+    std::uint64_t timestamp;
+    std::uintptr_t address;
+    std::uint64_t value; // the bits of the field, shifted to the lowest position
+    std::uint8_t width;  // the register width in bytes
+    trace_kind kind;
+    std::uint8_t first_bit;
+    std::uint8_t last_bit;
+};
+
+namespace detail
+{
+/// @brief  Reads the CPU's timestamp counter (TSC on x86, the virtual counter on AArch64),
+///         or the steady clock's nanoseconds on other targets.
+inline std::uint64_t trace_timestamp()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    // the builtin avoids including the whole x86 intrinsics header
+    return __builtin_ia32_rdtsc();
+#elif defined(__aarch64__)
+    std::uint64_t ticks;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(ticks));
+    return ticks;
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+#endif
+}
+} // namespace detail
+
+/// @brief  The trace_ring class is the default sink of the @ref traced operations:
+///         a fixed-size ring buffer for each thread, which keeps the latest records.
+///         Only the owning thread writes its buffer, so recording needs neither locks
+///         nor read-modify-write atomics.
+/// @tparam CAPACITY: the number of records kept by each thread, a power of two
+template <std::size_t CAPACITY = 4096>
+class trace_ring
+{
+    static_assert(std::has_single_bit(CAPACITY), "the capacity must be a power of two");
+
+  public:
+    /// @brief  The calling thread's buffer.
+    static trace_ring& local()
+    {
+        thread_local trace_ring ring;
+        return ring;
+    }
+    static void record(const trace_record& record) { local().push(record); }
+
+    void push(const trace_record& record)
+    {
+        const auto count = count_.load(std::memory_order_relaxed);
+        records_[count & (CAPACITY - 1)] = record;
+        count_.store(count + 1, std::memory_order_release);
+    }
+
+    /// @brief  The number of records ever pushed, including the overwritten ones.
+    std::uint64_t total() const { return count_.load(std::memory_order_acquire); }
+    /// @brief  The number of records available.
+    std::size_t size() const
+    {
+        const auto count = total();
+        return (count < CAPACITY) ? static_cast<std::size_t>(count) : CAPACITY;
+    }
+    static constexpr std::size_t capacity() { return CAPACITY; }
+    void clear() { count_.store(0, std::memory_order_release); }
+
+    /// @brief  Calls the function with the available records, from the oldest to the newest.
+    /// @note   The records are only consistent when the owner thread isn't recording meanwhile.
+    template <typename TFunction>
+    void for_each(TFunction&& function) const
+    {
+        const auto count = total();
+        for (auto i = count - size(); i < count; ++i)
+        {
+            function(records_[i & (CAPACITY - 1)]);
+        }
+    }
+
+    /// @brief  Writes the available records as CSV, the input format of tools/trace_histogram.py
+    void dump(std::FILE* file) const
+    {
+        std::fputs("timestamp,address,width,kind,first_bit,last_bit,value\n", file);
+        for_each(
+            [file](const trace_record& record)
+            {
+                static constexpr std::array<const char*, 3> kinds{"read", "write", "modify"};
+                std::fprintf(file, "%llu,0x%llx,%u,%s,%u,%u,0x%llx\n",
+                             static_cast<unsigned long long>(record.timestamp),
+                             static_cast<unsigned long long>(record.address),
+                             static_cast<unsigned>(record.width),
+                             kinds[static_cast<std::size_t>(record.kind)],
+                             static_cast<unsigned>(record.first_bit),
+                             static_cast<unsigned>(record.last_bit),
+                             static_cast<unsigned long long>(record.value));
+            });
+    }
+
+  private:
+    std::array<trace_record, CAPACITY> records_{};
+    std::atomic<std::uint64_t> count_{};
+};
+
+/// @tparam TOps: the operations to access the register with (e.g. @ref base or @ref bitband)
+/// @tparam TSink: the type receiving the records via its static record(const trace_record&)
+///         function (e.g. @ref trace_ring)
+template <typename TOps = base, typename TSink = trace_ring<>>
+struct traced
+{
+#if BITFILLED_TRACE
+    /// @brief  These bitfield operations record every register operation of the wrapped
+    ///         operations: the register address and width, the kind of access,
+    ///         the field's bit range and value, and a timestamp.
+    /// @note   A field write of a readable register is recorded as a single modify operation,
+    ///         which consists of a read and a write access when performed by @ref base,
+    ///         or as a write when the wrapped operations only store it (see @ref write_traits).
+    /// @tparam T
+    /// @tparam ACCESS
+    template <typename T, enum access ACCESS = access::readwrite>
+    struct bitfield_ops : private TOps::template bitfield_ops<T, ACCESS>
+    {
+        using int_type = typename T::value_type;
+
+      private:
+        using base_ops = typename TOps::template bitfield_ops<T, ACCESS>;
+        using unsigned_type = std::make_unsigned_t<int_type>;
+        static constexpr auto width = sizeof(int_type);
+        // writes which don't read the register (write-only, or by the wrapped ops' stores)
+        // are recorded as such, the others as read-modify-write
+        static constexpr bool stores_only = !is_readable<ACCESS> or is_ephemeralwrite<ACCESS>;
+        static constexpr trace_kind field_write_kind(std::size_t size_bits)
+        {
+            return (stores_only or write_traits<TOps>::stores_field(size_bits))
+                       ? trace_kind::write
+                       : trace_kind::modify;
+        }
+        static constexpr auto modify_kind = (stores_only or write_traits<TOps>::stores_modify())
+                                                ? trace_kind::write
+                                                : trace_kind::modify;
+
+        template <typename Tptr>
+        static void record(const Tptr& ptr, trace_kind kind, std::size_t first_bit,
+                           std::size_t last_bit, int_type value)
+        {
+            const auto size_bits = last_bit - first_bit + 1;
+            const auto bits = static_cast<std::uint64_t>(static_cast<unsigned_type>(value)) &
+                              (size_bits < 64 ? ((std::uint64_t{1} << size_bits) - 1) : ~0ull);
+            TSink::record(trace_record{
+                .timestamp = detail::trace_timestamp(),
+                .address =
+                    reinterpret_cast<std::uintptr_t>(static_cast<const volatile void*>(&ptr)),
+                .value = bits,
+                .width = static_cast<std::uint8_t>(width),
+                .kind = kind,
+                .first_bit = static_cast<std::uint8_t>(first_bit),
+                .last_bit = static_cast<std::uint8_t>(last_bit),
+            });
+        }
+        template <typename Tptr>
+        static void record_value(const Tptr& ptr, trace_kind kind, int_type value)
+        {
+            record(ptr, kind, 0, (width * 8) - 1, value);
+        }
+
+      public:
+        static constexpr enum access access() { return ACCESS; }
+
+        template <typename Tptr>
+        static int_type get_value(const Tptr& ptr)
+            requires(is_readable<ACCESS>)
+        {
+            const auto value = base_ops::get_value(ptr);
+            record_value(ptr, trace_kind::read, value);
+            return value;
+        }
+        template <typename Tptr>
+        static void set_value(Tptr& ptr, int_type value)
+            requires(is_writeable<ACCESS>)
+        {
+            base_ops::set_value(ptr, value);
+            record_value(ptr, trace_kind::write, value);
+        }
+        template <typename Tptr>
+        static void modify_value(Tptr& ptr, int_type mask, int_type value)
+            requires(is_writeable<ACCESS>)
+        {
+            base_ops::modify_value(ptr, mask, value);
+            // the modified bit range is recorded as a single field
+            const auto bits = static_cast<unsigned_type>(mask);
+            if (bits == 0)
+            {
+                record_value(ptr, modify_kind, 0);
+                return;
+            }
+            const auto first_bit = static_cast<std::size_t>(std::countr_zero(bits));
+            record(ptr, modify_kind, first_bit, static_cast<std::size_t>(std::bit_width(bits)) - 1,
+                   static_cast<int_type>(static_cast<unsigned_type>(value & mask) >> first_bit));
+        }
+
+        template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+        static void set_field(bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            base_ops::set_field(bf, value);
+            record(bf, field_write_kind(1 + LAST_BIT - FIRST_BIT), FIRST_BIT, LAST_BIT,
+                   static_cast<int_type>(value));
+        }
+        template <std::size_t FIRST_BIT, std::size_t LAST_BIT, typename TVal>
+        static void set_field(volatile bitfield_props<FIRST_BIT, LAST_BIT>& bf, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            base_ops::set_field(bf, value);
+            record(bf, field_write_kind(1 + LAST_BIT - FIRST_BIT), FIRST_BIT, LAST_BIT,
+                   static_cast<int_type>(value));
+        }
+        template <typename TVal, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+        static TVal get_field(const bitfield_props<FIRST_BIT, LAST_BIT>& bf)
+            requires(is_readable<ACCESS>)
+        {
+            const auto value = base_ops::template get_field<TVal>(bf);
+            record(bf, trace_kind::read, FIRST_BIT, LAST_BIT, static_cast<int_type>(value));
+            return value;
+        }
+        template <typename TVal, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+        static TVal get_field(const volatile bitfield_props<FIRST_BIT, LAST_BIT>& bf)
+            requires(is_readable<ACCESS>)
+        {
+            const auto value = base_ops::template get_field<TVal>(bf);
+            record(bf, trace_kind::read, FIRST_BIT, LAST_BIT, static_cast<int_type>(value));
+            return value;
+        }
+
+        template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+        static void set_item(regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            base_ops::set_item(bf, index, value);
+            record(bf, field_write_kind(ITEM_SIZE), bf.offset(index),
+                   bf.offset(index) + ITEM_SIZE - 1, static_cast<int_type>(value));
+        }
+        template <std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET, typename TVal>
+        static void set_item(volatile regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index, TVal value)
+            requires(is_writeable<ACCESS>)
+        {
+            base_ops::set_item(bf, index, value);
+            record(bf, field_write_kind(ITEM_SIZE), bf.offset(index),
+                   bf.offset(index) + ITEM_SIZE - 1, static_cast<int_type>(value));
+        }
+        template <typename TVal, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+        static TVal get_item(const regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index)
+            requires(is_readable<ACCESS>)
+        {
+            const auto value = base_ops::template get_item<TVal>(bf, index);
+            record(bf, trace_kind::read, bf.offset(index), bf.offset(index) + ITEM_SIZE - 1,
+                   static_cast<int_type>(value));
+            return value;
+        }
+        template <typename TVal, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+        static TVal get_item(const volatile regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>& bf,
+                             std::size_t index)
+            requires(is_readable<ACCESS>)
+        {
+            const auto value = base_ops::template get_item<TVal>(bf, index);
+            record(bf, trace_kind::read, bf.offset(index), bf.offset(index) + ITEM_SIZE - 1,
+                   static_cast<int_type>(value));
+            return value;
+        }
+    };
+#else
+    template <typename T, enum access ACCESS = access::readwrite>
+    using bitfield_ops = typename TOps::template bitfield_ops<T, ACCESS>;
+#endif
+};
+
+} // namespace bitfilled
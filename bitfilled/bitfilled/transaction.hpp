@@ -0,0 +1,325 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <bit>
+#include <tuple>
+#include "bitfilled/bits.hpp"
+
+namespace bitfilled
+{
+namespace detail
+{
+template <typename T>
+struct member_pointer_traits
+{};
+template <typename TClass, typename TMember>
+struct member_pointer_traits<TMember TClass::*>
+{
+    using class_type = TClass;
+    using member_type = TMember;
+};
+
+template <typename TInt, std::size_t FIRST_BIT, std::size_t LAST_BIT>
+constexpr TInt props_mask(const bitfield_props<FIRST_BIT, LAST_BIT>*)
+{
+    using props_type = bitfield_props<FIRST_BIT, LAST_BIT>;
+    return static_cast<TInt>(props_type::template mask<TInt>() << FIRST_BIT);
+}
+template <typename TInt, std::size_t ITEM_SIZE, std::size_t ITEM_COUNT, std::size_t OFFSET>
+constexpr TInt props_mask(const regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>*)
+{
+    using props_type = regbitfieldset_props<ITEM_SIZE, ITEM_COUNT, OFFSET>;
+    TInt mask{};
+    for (std::size_t i = 0; i < ITEM_COUNT; ++i)
+    {
+        mask = static_cast<TInt>(mask |
+                                 (props_type::template mask<TInt>() << props_type::offset(i)));
+    }
+    return mask;
+}
+
+/// @brief  The positioned bitmask of the fields (all items of field sets)
+///         within the owner's integer value.
+template <typename TInt, typename... TFields>
+constexpr TInt fields_mask()
+{
+    return static_cast<TInt>((TInt{} | ... |
+                              props_mask<TInt>(
+                                  static_cast<const typename TFields::props_type*>(nullptr))));
+}
+
+/// @brief  Whether the classes declaring the fields are the owner type or its bases,
+///         so the fields belong to the owner (and not to another type with the same ops).
+template <typename TReg, typename... TClasses>
+inline constexpr bool members_of = (std::is_base_of_v<TClasses, std::remove_cv_t<TReg>> and ...);
+} // namespace detail
+
+/// @brief  The field_assignment class holds a value to be written to a bitfield,
+///         as part of a multi-field transaction.
+/// @tparam TField: the (reg)bitfield type
+/// @tparam TClass: the class declaring the bitfield member
+template <typename TField, typename TClass>
+struct field_assignment
+{
+    using field_type = TField;
+    using class_type = TClass;
+    using value_type = typename TField::value_type;
+    using props_type = typename TField::props_type;
+    static_assert(!TField::dynamic_index,
+                  "field sets cannot be assigned as a whole, assign their items instead");
+
+    value_type value;
+
+    /// @brief  The positioned bitmask of the field within the owner's integer value.
+    template <typename TInt>
+    constexpr static TInt mask()
+    {
+        return static_cast<TInt>(props_type::template mask<TInt>() << props_type::offset());
+    }
+    /// @brief  The assigned value positioned within the owner's integer value.
+    template <typename TInt>
+    constexpr TInt positioned() const
+    {
+        return props_type::position_field(static_cast<TInt>(value));
+    }
+};
+
+/// @brief  The field_ref class identifies a bitfield member of an owner type
+///         by its member pointer, to be used in multi-field transactions.
+/// @tparam MEMBER: the bitfield member pointer, e.g. &systick::csr::ENABLE
+template <auto MEMBER>
+struct field_ref
+{
+    using class_type = typename detail::member_pointer_traits<decltype(MEMBER)>::class_type;
+    using field_type = typename detail::member_pointer_traits<decltype(MEMBER)>::member_type;
+    using value_type = typename field_type::value_type;
+
+    // NOLINTNEXTLINE(misc-unconventional-assign-operator,cppcoreguidelines-c-copy-assignment-signature)
+    constexpr field_assignment<field_type, class_type> operator=(value_type value) const
+    {
+        return {value};
+    }
+};
+
+/// @brief  Shorthand for creating field assignments: field<&reg::FIELD> = value
+template <auto MEMBER>
+inline constexpr field_ref<MEMBER> field{};
+
+/// @brief  Extracts the value of a bitfield from a previously captured value of its owner.
+/// @tparam TField: the (reg)bitfield type
+/// @param  value: the integer value of the owner
+template <typename TField, typename TInt>
+constexpr typename TField::value_type extract(TInt value)
+{
+    using props_type = typename TField::props_type;
+    auto typeval = static_cast<typename TField::value_type>(props_type::extract_field(value));
+    return props_type::sign_extend(typeval);
+}
+
+/// @brief  Reads multiple fields of the same owner with a single read access,
+///         so that the returned values are consistent with each other.
+/// @param  reg: the owner object (@ref host_integer, @ref packed_integer, @ref mmreg subclass)
+/// @param  members: the bitfield member pointers, e.g. &systick::csr::ENABLE
+/// @return a tuple of the field values, in the order of the arguments
+///         (suitable for structured bindings)
+template <typename TReg, typename... TClasses, typename... TFields>
+constexpr std::tuple<typename TFields::value_type...>
+read(const TReg& reg, [[maybe_unused]] TFields TClasses::*... members)
+{
+    using ops_type = typename std::remove_cv_t<TReg>::bf_ops;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the read object");
+    static_assert((is_readable<TFields::access()> and ...), "the fields must be readable");
+
+    const auto value = ops_type::get_value(reg);
+    return {extract<TFields>(value)...};
+}
+
+/// @brief  Writes multiple fields of the same owner with a single read-modify-write cycle.
+///         The combined mask is computed at compile time, the field values are merged
+///         before the single write.
+/// @param  reg: the owner object (@ref host_integer, @ref packed_integer, @ref mmreg subclass)
+/// @param  assignments: the field assignments, created with @ref field
+template <typename TReg, typename... TFields, typename... TClasses>
+constexpr void modify(TReg& reg, field_assignment<TFields, TClasses>... assignments)
+{
+    using ops_type = typename std::remove_cv_t<TReg>::bf_ops;
+    using int_type = typename std::remove_cv_t<TReg>::value_type;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the modified object");
+    static_assert((is_writeable<TFields::access()> and ...), "the fields must be writeable");
+
+    constexpr auto mask = detail::fields_mask<int_type, TFields...>();
+    const auto value =
+        static_cast<int_type>((int_type{} | ... | assignments.template positioned<int_type>()));
+    ops_type::modify_value(reg, mask, value);
+}
+
+namespace detail
+{
+/// @brief  Whether the assigned fields occupy distinct bits of the owner's integer value.
+template <typename TInt, typename... TFields>
+constexpr bool fields_disjoint()
+{
+    using unsigned_type = std::make_unsigned_t<TInt>;
+    constexpr auto all = static_cast<unsigned_type>(
+        (unsigned_type{} | ... | static_cast<unsigned_type>(fields_mask<TInt, TFields>())));
+    return (0 + ... + std::popcount(static_cast<unsigned_type>(fields_mask<TInt, TFields>()))) ==
+           std::popcount(all);
+}
+} // namespace detail
+
+/// @brief  Computes the integer value of an owner type with the given field values,
+///         without accessing any object. With constant values the result is a constant,
+///         so the register is initialized with a single write, instead of a read-modify-write
+///         cycle for each field.
+/// @tparam TReg: the owner type (@ref host_integer, @ref packed_integer, @ref mmreg subclass)
+/// @param  initial: the value of the bits outside of the fields (e.g. the reset value)
+/// @param  assignments: the field assignments, created with @ref field
+/// @return the integer value of the owner
+template <typename TReg, typename... TFields, typename... TClasses>
+constexpr typename TReg::value_type build(typename TReg::value_type initial,
+                                          field_assignment<TFields, TClasses>... assignments)
+{
+    using int_type = typename TReg::value_type;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the built type");
+    static_assert((is_writeable<TFields::access()> and ...), "the fields must be writeable");
+    static_assert(detail::fields_disjoint<int_type, TFields...>(),
+                  "the fields must not overlap");
+
+    constexpr auto mask = static_cast<int_type>(
+        (int_type{} | ... | field_assignment<TFields, TClasses>::template mask<int_type>()));
+    return static_cast<int_type>((initial & static_cast<int_type>(~mask)) |
+                                 (int_type{} | ... | assignments.template positioned<int_type>()));
+}
+
+/// @brief  Computes the integer value of an owner type with the given field values,
+///         the other bits being zero.
+template <typename TReg, typename... TFields, typename... TClasses>
+constexpr typename TReg::value_type build(field_assignment<TFields, TClasses>... assignments)
+{
+    return build<TReg>(typename TReg::value_type{}, assignments...);
+}
+
+/// @brief  The register_value class holds the value of a register of a peripheral,
+///         as an entry of a @ref register_image.
+/// @tparam MEMBER: the register member pointer, e.g. &periph_t::CTRL
+template <auto MEMBER>
+struct register_value
+{
+    using class_type = typename detail::member_pointer_traits<decltype(MEMBER)>::class_type;
+    using register_type = typename detail::member_pointer_traits<decltype(MEMBER)>::member_type;
+    using value_type = typename register_type::value_type;
+
+    value_type value;
+
+    /// @brief  Writes the value to the register of the peripheral, in a single access.
+    template <typename TPeriph>
+    constexpr void write(TPeriph& periph) const
+    {
+        register_type::bf_ops::set_value(periph.*MEMBER, value);
+    }
+};
+
+/// @brief  Creates the value of a peripheral's register from field assignments.
+/// @tparam MEMBER: the register member pointer, e.g. &periph_t::CTRL
+/// @param  args: the arguments of @ref build (an optional initial value, the field assignments)
+template <auto MEMBER, typename... TArgs>
+constexpr register_value<MEMBER> register_init(TArgs... args)
+{
+    return {build<typename register_value<MEMBER>::register_type>(args...)};
+}
+
+/// @brief  The register_image class is a table of register values of a peripheral,
+///         computed at compile time, and written to the registers in the order of the entries,
+///         with a single write each.
+/// @tparam MEMBERS: the register member pointers
+template <auto... MEMBERS>
+struct register_image
+{
+    std::tuple<register_value<MEMBERS>...> values;
+
+    constexpr register_image(register_value<MEMBERS>... entries) : values(entries...) {}
+
+    static constexpr std::size_t size() { return sizeof...(MEMBERS); }
+
+    /// @brief  Writes the values to the registers of the peripheral.
+    template <typename TPeriph>
+    constexpr void write(TPeriph& periph) const
+    {
+        std::apply([&periph](const auto&... entries) { (entries.write(periph), ...); }, values);
+    }
+};
+
+/// @brief  Tests whether multiple fields of the same owner have the given values,
+///         with a single read access and a single masked comparison.
+///         The combined mask is computed at compile time.
+/// @param  reg: the owner object (@ref host_integer, @ref packed_integer, @ref mmreg subclass)
+/// @param  expected: the expected field values, created with @ref field
+/// @return true if all fields have the expected values
+template <typename TReg, typename... TFields, typename... TClasses>
+constexpr bool match(const TReg& reg, field_assignment<TFields, TClasses>... expected)
+{
+    using ops_type = typename std::remove_cv_t<TReg>::bf_ops;
+    using int_type = typename std::remove_cv_t<TReg>::value_type;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the matched object");
+    static_assert((is_readable<TFields::access()> and ...), "the fields must be readable");
+
+    constexpr auto mask = detail::fields_mask<int_type, TFields...>();
+    const auto value =
+        static_cast<int_type>((int_type{} | ... | expected.template positioned<int_type>()));
+    return static_cast<int_type>(ops_type::get_value(reg) & mask) == value;
+}
+
+/// @brief  The field_matcher class is a predicate, which matches the owner objects
+///         with the given field values (e.g. for std::find_if on lookup tables).
+/// @tparam TAssignments: the @ref field_assignment types of the expected values
+template <typename... TAssignments>
+struct field_matcher
+{
+    std::tuple<TAssignments...> expected;
+
+    template <typename TReg>
+    constexpr bool operator()(const TReg& reg) const
+    {
+        return std::apply([&reg](auto... values) { return match(reg, values...); }, expected);
+    }
+};
+
+/// @brief  Creates a predicate that matches owner objects with the given field values.
+/// @param  expected: the expected field values, created with @ref field
+template <typename... TFields, typename... TClasses>
+constexpr field_matcher<field_assignment<TFields, TClasses>...>
+matching(field_assignment<TFields, TClasses>... expected)
+{
+    return {{expected...}};
+}
+
+/// @brief  Tests whether any bit of the fields is set, with a single read access.
+/// @param  reg: the owner object (@ref host_integer, @ref packed_integer, @ref mmreg subclass)
+/// @param  members: the bitfield member pointers, e.g. &systick::csr::COUNTFLAG
+template <typename TReg, typename... TClasses, typename... TFields>
+constexpr bool any_set(const TReg& reg, [[maybe_unused]] TFields TClasses::*... members)
+{
+    using ops_type = typename std::remove_cv_t<TReg>::bf_ops;
+    using int_type = typename std::remove_cv_t<TReg>::value_type;
+    static_assert(detail::members_of<TReg, TClasses...>,
+                  "the fields must be members of the tested object");
+    static_assert((is_readable<TFields::access()> and ...), "the fields must be readable");
+
+    constexpr auto mask = detail::fields_mask<int_type, TFields...>();
+    return static_cast<int_type>(ops_type::get_value(reg) & mask) != 0;
+}
+
+/// @brief  Tests whether all bits of the fields are clear, with a single read access.
+/// @param  reg: the owner object (@ref host_integer, @ref packed_integer, @ref mmreg subclass)
+/// @param  members: the bitfield member pointers, e.g. &systick::csr::COUNTFLAG
+template <typename TReg, typename... TClasses, typename... TFields>
+constexpr bool all_clear(const TReg& reg, TFields TClasses::*... members)
+{
+    return !any_set(reg, members...);
+}
+
+} // namespace bitfilled
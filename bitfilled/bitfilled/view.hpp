@@ -0,0 +1,158 @@
+// SPDX-License-Identifier: MPL-2.0
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+
+namespace bitfilled
+{
+namespace detail
+{
+/// @brief  Whether objects of the type can be created implicitly in a byte buffer
+///         (aggregates, such as layouts of packed integers, and trivially copyable types).
+template <typename T>
+inline constexpr bool is_implicit_lifetime =
+#if __cpp_lib_is_implicit_lifetime
+    std::is_implicit_lifetime_v<T>;
+#else
+    std::is_trivially_destructible_v<T> and
+    (std::is_aggregate_v<T> or std::is_trivially_default_constructible_v<T> or
+     std::is_trivially_copy_constructible_v<T> or std::is_trivially_move_constructible_v<T>);
+#endif
+
+template <typename T>
+constexpr void check_packed_layout()
+{
+    static_assert(alignof(T) == 1, "the layout must not require alignment, use packed_integer");
+    static_assert(std::is_trivially_destructible_v<T>, "the layout must be trivially destructible");
+    static_assert(is_implicit_lifetime<T>,
+                  "the layout must be an aggregate or trivially copyable, to be created in a buffer");
+}
+
+/// @brief  Creates a layout object in a modifiable byte buffer, without modifying the buffer.
+template <typename T>
+T* start_lifetime_as(std::byte* bytes)
+{
+#if __cpp_lib_start_lifetime_as
+    return std::start_lifetime_as<T>(bytes);
+#else
+    // copying the bytes onto themselves implicitly creates the object in place
+    return std::launder(static_cast<T*>(std::memmove(bytes, bytes, sizeof(T))));
+#endif
+}
+
+/// @brief  Creates a layout object in place in a read-only byte buffer.
+template <typename T>
+const T* start_lifetime_as(const std::byte* bytes)
+{
+#if __cpp_lib_start_lifetime_as
+    return std::start_lifetime_as<T>(bytes);
+#else
+    // the bytes cannot be copied onto themselves, as the buffer may be read-only memory (flash)
+    static_assert(sizeof(T) == 0, "viewing a read-only buffer requires std::start_lifetime_as, "
+                                  "view a modifiable buffer instead");
+    return nullptr;
+#endif
+}
+} // namespace detail
+
+/// @brief  The packed_view class overlays a read-only layout on a received byte buffer,
+///         so that its (packed_integer and bitfield) members are decoded in place, without copying.
+///         The buffer size is checked once, when the view is created.
+/// @note   Without std::start_lifetime_as, the layout can only be created in a modifiable buffer
+///         (which isn't modified by the view).
+/// @tparam T: the layout type, which is composed of @ref packed_integer members (or subclasses)
+template <typename T>
+class packed_view
+{
+  public:
+    using value_type = T;
+
+    static constexpr std::size_t size() { return sizeof(T); }
+
+    constexpr packed_view() = default;
+    /// @param  bytes: the modifiable or read-only buffer
+    template <typename TByte, std::size_t EXTENT>
+        requires(std::is_same_v<std::remove_const_t<TByte>, std::byte>)
+    explicit packed_view(std::span<TByte, EXTENT> bytes)
+        : object_(bytes.size() >= size() ? detail::start_lifetime_as<T>(bytes.data()) : nullptr),
+          bytes_(object_ ? std::span<const std::byte>(bytes) : std::span<const std::byte>())
+    {
+        detail::check_packed_layout<T>();
+    }
+
+    /// @brief  Whether the buffer is large enough to hold the layout.
+    explicit operator bool() const { return object_ != nullptr; }
+
+    const T& operator*() const
+    {
+        assert(object_ != nullptr);
+        return *object_;
+    }
+    const T* operator->() const
+    {
+        assert(object_ != nullptr);
+        return object_;
+    }
+
+    /// @brief  The bytes of the buffer following the layout (e.g. the payload after a header).
+    std::span<const std::byte> tail() const
+    {
+        return bytes_.empty() ? bytes_ : bytes_.subspan(size());
+    }
+
+  private:
+    const T* object_{};
+    std::span<const std::byte> bytes_{};
+};
+
+/// @brief  The packed_ref class overlays a modifiable layout on a byte buffer,
+///         so that its (packed_integer and bitfield) members are encoded in place, without copying.
+///         The buffer size is checked once, when the reference is created.
+/// @tparam T: the layout type, which is composed of @ref packed_integer members (or subclasses)
+template <typename T>
+class packed_ref
+{
+  public:
+    using value_type = T;
+
+    static constexpr std::size_t size() { return sizeof(T); }
+
+    constexpr packed_ref() = default;
+    explicit packed_ref(std::span<std::byte> bytes)
+        : object_(bytes.size() >= size() ? detail::start_lifetime_as<T>(bytes.data()) : nullptr),
+          bytes_(object_ ? bytes : std::span<std::byte>())
+    {
+        detail::check_packed_layout<T>();
+    }
+
+    /// @brief  Whether the buffer is large enough to hold the layout.
+    explicit operator bool() const { return object_ != nullptr; }
+
+    T& operator*() const
+    {
+        assert(object_ != nullptr);
+        return *object_;
+    }
+    T* operator->() const
+    {
+        assert(object_ != nullptr);
+        return object_;
+    }
+
+    /// @brief  The bytes of the buffer following the layout (e.g. the payload after a header).
+    std::span<std::byte> tail() const { return bytes_.empty() ? bytes_ : bytes_.subspan(size()); }
+
+    operator packed_view<T>() const { return packed_view<T>(bytes_); }
+
+  private:
+    T* object_{};
+    std::span<std::byte> bytes_{};
+};
+
+} // namespace bitfilled
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <vector>
+#include "bitfilled.hpp"
+#include "bitfilled/async.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+using namespace std::chrono_literals;
+
+/// a temperature sensor behind a slow bus, with 8-bit and 16-bit big endian registers
+struct sensor_t : async_device<sensor_t>
+{
+    using async_device::async_device;
+
+    struct STATUS_t : BF_ASYNCREG(std::uint8_t, r, 0x00)
+    {
+        BF_MMREGBITS(bool, r, 0) ready;
+        BF_MMREGBITS(std::uint8_t, r, 4, 7) fault;
+    };
+    struct CONFIG_t : BF_ASYNCREG(std::uint8_t, rw, 0x01)
+    {
+        BF_MMREGBITS(bool, rw, 0) enable;
+        BF_MMREGBITS(std::uint8_t, rw, 2, 5) rate;
+    };
+    struct TEMP_t : BF_ASYNCREG(std::uint16_t, r, 0x02)
+    {
+        BF_MMREGBITS(std::int16_t, r, 4, 15) celsius_16th;
+        BF_MMREGBITS(bool, r, 0) valid;
+    };
+    struct COMMAND_t : BF_ASYNCREG(std::uint8_t, w, 0x04)
+    {
+        BF_MMREGBITS(bool, w, 0) reset;
+        BF_MMREGBITS(bool, w, 1) oneshot;
+    };
+
+    [[no_unique_address]] STATUS_t STATUS;
+    [[no_unique_address]] CONFIG_t CONFIG;
+    [[no_unique_address]] TEMP_t TEMP;
+    [[no_unique_address]] COMMAND_t COMMAND;
+};
+
+static_assert(sizeof(sensor_t) == sizeof(bitfilled::detail::async_bus));
+static_assert(AsyncRegister<sensor_t::TEMP_t> and !AsyncField<sensor_t::TEMP_t>);
+static_assert(AsyncField<decltype(sensor_t::TEMP_t::celsius_16th)>);
+
+/// @brief  Configures the sensor, and reads a measurement.
+static async_task<int> measure(sensor_t& sensor)
+{
+    co_await async_modify(sensor.CONFIG, field<&sensor_t::CONFIG_t::enable> = true,
+                          field<&sensor_t::CONFIG_t::rate> = 5);
+    co_await async_modify(sensor.COMMAND, field<&sensor_t::COMMAND_t::oneshot> = true);
+    if (!co_await async_read(sensor.STATUS.ready))
+    {
+        co_return -1;
+    }
+    const auto temp = co_await async_read(sensor.TEMP.celsius_16th);
+    co_return temp / 16;
+}
+
+/// @brief  Reads the temperature of the sensor, counting the readers in flight.
+static async_task<> read_temp(sensor_t& sensor, int& started, int& concurrent,
+                              std::uint16_t& value)
+{
+    ++started;
+    value = co_await async_read(sensor.TEMP);
+    concurrent = std::max(concurrent, started);
+}
+
+const suite async_suite = []
+{
+    "async field access"_test = []
+    {
+        loopback_transport registers{8};
+        async_executor executor;
+        latency_transport bus{registers, executor, 100us};
+        sensor_t sensor{bus};
+        auto memory = registers.memory();
+        memory[0] = std::byte{0x01};
+        memory[2] = std::byte{0xe7}; // -24.5 Celsius
+        memory[3] = std::byte{0x81};
+
+        auto task = measure(sensor);
+        expect(!task.done());
+        executor.start(task);
+        executor.run();
+        expect(task.done() >> fatal);
+        expect(that % task.result() == -24);
+        expect(memory[1] == std::byte{0x15});
+        expect(memory[4] == std::byte{0x02});
+        // the read-modify-write of CONFIG, the write of COMMAND and the two reads
+        const auto& log = registers.log();
+        expect((log.size() == 5u) >> fatal);
+        expect(!log[0].write and log[1].write and log[2].write and !log[3].write and
+               !log[4].write);
+        expect(bool(sensor));
+        expect(executor.idle());
+    };
+
+    "async register access"_test = []
+    {
+        loopback_transport registers{8};
+        async_executor executor;
+        latency_transport bus{registers, executor, 10us};
+        sensor_t sensor{bus, std::endian::little};
+        auto task = [](sensor_t& s) -> async_task<std::uint16_t>
+        {
+            co_await async_write(s.CONFIG, 0x3c);
+            const auto config = co_await async_read(s.CONFIG);
+            co_return static_cast<std::uint16_t>(config + co_await async_read(s.TEMP));
+        }(sensor);
+        registers.memory()[2] = std::byte{0x34};
+        registers.memory()[3] = std::byte{0x12};
+        executor.start(task);
+        executor.run();
+        expect(that % task.result() == 0x1234 + 0x3c);
+    };
+
+    "async pipelined requests"_test = []
+    {
+        constexpr auto latency = 2ms;
+        constexpr int count = 8;
+        for (const std::size_t depth : {std::size_t{1}, std::size_t{count}})
+        {
+            loopback_transport registers{8};
+            async_executor executor;
+            latency_transport bus{registers, executor, latency, depth};
+            sensor_t sensor{bus};
+            registers.memory()[3] = std::byte{0x42};
+
+            int started = 0;
+            int concurrent = 0;
+            std::array<std::uint16_t, count> values{};
+            std::vector<async_task<>> tasks;
+            for (auto& value : values)
+            {
+                tasks.push_back(read_temp(sensor, started, concurrent, value));
+                executor.start(tasks.back());
+            }
+            const auto start = async_executor::clock::now();
+            executor.run();
+            const auto elapsed = async_executor::clock::now() - start;
+
+            // all the requests were in flight before the first one completed
+            expect(that % concurrent == count);
+            expect(that % bus.max_outstanding() == std::size_t{count});
+            expect(std::ranges::all_of(values, [](auto v) { return v == 0x42; }));
+            expect(elapsed >= (latency * count / static_cast<int>(depth)));
+        }
+    };
+
+    "async transport errors"_test = []
+    {
+        loopback_transport registers{2};
+        async_executor executor;
+        latency_transport bus{registers, executor, 10us};
+        sensor_t sensor{bus};
+        registers.memory()[0] = std::byte{0xff};
+        auto task = [](sensor_t& s) -> async_task<int>
+        {
+            const auto fault = co_await async_read(s.STATUS.fault);
+            // the write of COMMAND fails
+            co_await async_modify(s.COMMAND, field<&sensor_t::COMMAND_t::reset> = true);
+            co_return fault + co_await async_read(s.TEMP.celsius_16th);
+        }(sensor);
+        executor.start(task);
+        executor.run();
+        expect(that % task.result() == 0xf);
+        expect(!sensor);
+        expect(sensor.error() == std::errc::bad_address);
+        expect(that % registers.log().size() == 3u);
+    };
+};
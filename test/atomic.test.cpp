@@ -0,0 +1,110 @@
+#include <thread>
+#include <vector>
+#include "bitfilled.hpp"
+#include "bitfilled/atomic_ops.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+enum class worker_state : std::uint8_t
+{
+    idle = 0,
+    running = 1,
+    done = 2,
+};
+
+struct shared_word : host_integer<std::uint64_t, atomic<>>
+{
+    BF_COPY_SUPERCLASS(shared_word);
+
+    BF_BITSET(bool, 1, 16) flags BF_BITSET_POSTFIX;
+    BF_BITSET(std::uint8_t, 4, 4, 16) counters BF_BITSET_POSTFIX;
+    BF_BITS(worker_state, 32, 33) state;
+    BF_BITS(std::int8_t, 40, 47) offset;
+};
+
+struct relaxed_word : host_integer<std::uint32_t, atomic<std::memory_order_relaxed>>
+{
+    BF_COPY_SUPERCLASS(relaxed_word);
+
+    BF_BITS(std::uint8_t, 0, 7) low;
+};
+
+const suite atomic_suite = []
+{
+    "atomic fields"_test = []
+    {
+        shared_word word{};
+        word.flags[3] = true;
+        word.counters[1] = 9;
+        word.state = worker_state::running;
+        word.offset = -3;
+        expect(word.flags[3]);
+        expect(!word.flags[2]);
+        expect(that % std::uint8_t(word.counters[1]) == 9);
+        expect(worker_state(word.state) == worker_state::running);
+        expect(that % std::int8_t(word.offset) == -3);
+        word.flags[3] = false;
+        expect(that % std::uint64_t(word) == 0x0000fd0100900000ull);
+
+        modify(word, field<&shared_word::state> = worker_state::done,
+               field<&shared_word::offset> = 5);
+        const auto [state, offset] =
+            read(word, std::memory_order_acquire, &shared_word::state, &shared_word::offset);
+        expect(state == worker_state::done);
+        expect(that % offset == 5);
+
+        relaxed_word relaxed{};
+        relaxed.low = 0x5a;
+        expect(that % std::uint8_t(relaxed.low) == 0x5a);
+    };
+
+    "atomic concurrent updates"_test = []
+    {
+        constexpr unsigned THREADS = 4;
+        constexpr unsigned ROUNDS = 10000;
+        shared_word word{};
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < THREADS; ++t)
+        {
+            threads.emplace_back([&word, t]
+            {
+                for (unsigned i = 0; i < ROUNDS; ++i)
+                {
+                    // each thread owns a flag and a counter, which share the word with the others
+                    word.flags[t] = (i % 2) == 0;
+                    word.counters[t] = static_cast<std::uint8_t>(i % 16);
+                }
+                word.flags[t + 8] = true;
+                word.counters[t] = static_cast<std::uint8_t>(t + 1);
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        for (unsigned t = 0; t < THREADS; ++t)
+        {
+            expect(!word.flags[t]);
+            expect(word.flags[t + 8]);
+            expect(that % std::uint8_t(word.counters[t]) == t + 1);
+        }
+    };
+
+    "atomic wait"_test = []
+    {
+        shared_word word{};
+        word.state = worker_state::running;
+        std::thread worker([&word]
+        {
+            word.flags[0] = true;
+            word.state = worker_state::done;
+            notify_all(word);
+        });
+        const auto state = wait<&shared_word::state>(word, worker_state::running);
+        worker.join();
+        expect(state == worker_state::done);
+        expect(word.flags[0]);
+    };
+};
@@ -0,0 +1,171 @@
+#include <cstring>
+#include <string>
+#include "bitfilled/binlog.hpp"
+#include "bitfilled/bits.hpp"
+#include "bitfilled/integer.hpp"
+#include "bitfilled/macros.hpp"
+#include "bitfilled/mmreg.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+namespace logged
+{
+enum class mode : std::uint8_t
+{
+    idle = 0,
+    run = 1,
+    halt = 2,
+};
+
+struct status : host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(status);
+
+    BF_BITS(bool, 0) ready;
+    BF_BITS(mode, 1, 2) state;
+    BF_BITS(std::int8_t, 4, 9) trim;
+    BF_BITSET(std::uint8_t, 4, 3, 16) levels BF_BITSET_POSTFIX;
+};
+
+struct periph_t
+{
+    using mmr_ops = bitfilled::base;
+    struct CTRL_t : BF_MMREG(std::uint16_t, rw, mmr_ops)
+    {
+        BF_COPY_SUPERCLASS(CTRL_t);
+        BF_MMREGBITS(std::uint16_t, rw, 0, 7) DIV;
+        BF_MMREGBITS(bool, rw, 15) EN;
+    } CTRL;
+};
+
+struct frame_header : packed_integer<std::endian::big, 3, std::uint32_t>
+{
+    using base_type = packed_integer<std::endian::big, 3, std::uint32_t>;
+    using base_type::operator=;
+    using bf_ops = base_type::bf_ops;
+
+    BF_BITS(std::uint8_t, 16, 23) type;
+    BF_BITS(std::uint16_t, 0, 15) length;
+};
+} // namespace logged
+
+BF_LAYOUT(logged::status, ready, state, trim, levels);
+BF_LAYOUT(logged::periph_t::CTRL_t, DIV, EN);
+BF_LAYOUT(logged::frame_header, type, length);
+
+/// @brief  Reads the value of the record at the position of the log, advancing the position.
+template <typename T>
+typename T::value_type read_record(std::span<const std::byte> records, std::size_t& pos)
+{
+    std::uint32_t id;
+    std::memcpy(&id, records.data() + pos, sizeof(id));
+    expect(that % id == layout_info<T>::id);
+    expect(that % static_cast<std::size_t>(records[pos + 4]) == sizeof(typename T::value_type));
+    typename T::value_type value;
+    std::memcpy(&value, records.data() + pos + 5, sizeof(value));
+    pos += 5 + sizeof(value);
+    return value;
+}
+
+const suite binlog_suite = []
+{
+    "layout metadata"_test = []
+    {
+        using info = layout_info<logged::status>;
+        static_assert(info::name == "logged::status");
+        static_assert(info::id == layout_id("logged::status"));
+        static_assert(info::fields.size() == 4);
+        static_assert(info::fields[0].name == "ready");
+        static_assert(info::fields[0].kind == field_kind::boolean);
+        static_assert(info::fields[1].kind == field_kind::enumeration);
+        static_assert((info::fields[1].first_bit == 1) and (info::fields[1].width == 2));
+        static_assert(info::fields[2].kind == field_kind::signed_integer);
+        static_assert((info::fields[3].first_bit == 16) and (info::fields[3].width == 4) and
+                      (info::fields[3].count == 3));
+        static_assert(layout_info<logged::periph_t::CTRL_t>::fields[1].first_bit == 15);
+        static_assert(layout_info<logged::frame_header>::fields[0].first_bit == 16);
+        // FNV-1a reference values
+        static_assert(layout_id("") == 2166136261u);
+        static_assert(layout_id("a") == 0xe40c292cu);
+    };
+
+    "binlog records"_test = []
+    {
+        binlog<64> log;
+        logged::status status{};
+        status.ready = true;
+        status.state = logged::mode::halt;
+        status.trim = -5;
+        status.levels[2] = 9;
+        logged::periph_t periph{};
+        periph.CTRL.DIV = 0x42;
+        periph.CTRL.EN = true;
+        logged::frame_header header{};
+        header.type = 7;
+        header.length = 0x1234;
+
+        log.append(status);
+        log.append(periph.CTRL);
+        log.append(header);
+        const auto records = log.records();
+        expect(that % records.size() == (5u + 4) + (5 + 2) + (5 + 4));
+
+        std::size_t pos = 0;
+        const logged::status logged_status{read_record<logged::status>(records, pos)};
+        expect(logged_status.ready);
+        expect(logged_status.state == logged::mode::halt);
+        expect(that % logged_status.trim == -5);
+        expect(that % logged_status.levels[2] == 9);
+        expect(that % read_record<logged::periph_t::CTRL_t>(records, pos) == 0x8042);
+        logged::frame_header logged_header{};
+        logged_header = read_record<logged::frame_header>(records, pos);
+        expect(that % logged_header.type == 7);
+        expect(that % logged_header.length == 0x1234);
+        expect(that % log.dropped() == 0u);
+    };
+
+    "binlog full buffer"_test = []
+    {
+        binlog<20> log;
+        logged::status status{};
+        for (int i = 0; i < 3; ++i)
+        {
+            log.append(status);
+        }
+        expect(that % log.records().size() == 18u);
+        expect(that % log.dropped() == 1u);
+
+        std::FILE* file = std::tmpfile();
+        expect((file != nullptr) >> fatal);
+        expect(log.flush(file));
+        expect(that % log.records().size() == 0u);
+        expect(that % std::ftell(file) == 8 + 18);
+        std::rewind(file);
+        std::uint32_t header[2];
+        expect(std::fread(header, sizeof(header), 1, file) == 1u);
+        expect(that % header[0] == 0x474c4642u);
+        expect(that % header[1] == 18u);
+        std::fclose(file);
+    };
+
+    "layout metadata as json"_test = []
+    {
+        std::FILE* file = std::tmpfile();
+        expect((file != nullptr) >> fatal);
+        write_layouts<logged::status, logged::periph_t::CTRL_t>(file);
+        std::string json(static_cast<std::size_t>(std::ftell(file)), '\0');
+        std::rewind(file);
+        expect(std::fread(json.data(), 1, json.size(), file) == json.size());
+        std::fclose(file);
+        expect(json.find("\"name\": \"logged::status\", \"id\": " +
+                         std::to_string(layout_info<logged::status>::id) + ", \"size\": 4") !=
+               std::string::npos);
+        expect(json.find("{\"name\": \"trim\", \"first_bit\": 4, \"width\": 6, \"count\": 1, "
+                         "\"kind\": \"signed\"}") != std::string::npos);
+        expect(json.find("{\"name\": \"levels\", \"first_bit\": 16, \"width\": 4, \"count\": 3, "
+                         "\"kind\": \"unsigned\"}") != std::string::npos);
+        expect(json.find("\"name\": \"logged::periph_t::CTRL_t\"") != std::string::npos);
+    };
+};
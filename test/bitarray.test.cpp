@@ -0,0 +1,91 @@
+#include "bitfilled/bitarray.hpp"
+#include "bitfilled/bits.hpp"
+#include "bitfilled/macros.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+struct slot_table : host_bitarray<100, std::uint8_t>
+{
+    BF_BITS(bool, 0) first;
+    BF_BITS(std::uint16_t, 4, 19) straddling;
+    BF_BITS(std::int32_t, 30, 41) signed_field;
+    BF_BITS(std::uint64_t, 35, 98) wide;
+    BF_BITSET(std::uint8_t, 5, 6, 60) items BF_BITSET_POSTFIX;
+};
+static_assert(sizeof(slot_table) == sizeof(slot_table::superclass));
+
+const suite bitarray = []
+{
+    "bitarray fields"_test = []
+    {
+        slot_table table;
+        table.first = true;
+        table.straddling = 0xabcd;
+        expect(that % table.first == true);
+        expect(that % table.straddling == 0xabcd);
+        expect(that % table.words()[0] == 0xd1);
+        expect(that % table.words()[1] == 0xbc);
+        expect(that % table.words()[2] == 0x0a);
+
+        table.signed_field = -1000;
+        expect(that % table.signed_field == -1000);
+        expect(that % table.straddling == 0xabcd);
+
+        table.wide = 0xfedc'ba98'7654'3210u;
+        expect(that % table.wide == 0xfedc'ba98'7654'3210u);
+        expect(that % table.get_bits(35, 64) == 0xfedc'ba98'7654'3210u);
+        expect(that % table.test(99) == false);
+        expect(that % table.first == true);
+    };
+
+    "bitarray sets"_test = []
+    {
+        slot_table table;
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            table.items[i] = static_cast<std::uint8_t>(i + 25);
+        }
+        for (std::size_t i = 0; i < 6; ++i)
+        {
+            expect(that % table.items[i] == i + 25);
+        }
+        expect(that % table.get_bits(60, 5) == 25u);
+        expect(that % table.get_bits(85, 5) == 30u);
+    };
+
+    "bitarray scans"_test = []<class TestType>
+    {
+        host_bitarray<1000, TestType> bits;
+        expect(that % bits.count() == 0u);
+        expect(that % bits.find_first_set() == 1000u);
+        expect(that % bits.find_first_zero() == 0u);
+
+        bits.set(700);
+        bits.set(3);
+        expect(that % bits.count() == 2u);
+        expect(that % bits.find_first_set() == 3u);
+        expect(that % bits.find_first_set(4) == 700u);
+        expect(that % bits.find_first_set(701) == 1000u);
+
+        bits.set_range(0, 999);
+        expect(that % bits.count() == 999u);
+        expect(that % bits.find_first_zero() == 999u);
+        expect(that % bits.find_first_zero(999) == 999u);
+        bits.set(999);
+        expect(that % bits.find_first_zero() == 1000u);
+
+        bits.clear_range(13, 500);
+        expect(that % bits.count() == 500u);
+        expect(that % bits.find_first_zero() == 13u);
+        expect(that % bits.find_first_set(13) == 513u);
+        expect(that % bits.test(12) == true);
+        expect(that % bits.test(13) == false);
+        expect(that % bits.test(512) == false);
+        expect(that % bits.test(513) == true);
+
+        bits.reset(999);
+        expect(that % bits.find_first_zero(513) == 999u);
+    } | std::tuple<std::uint8_t, std::uint32_t, std::uint64_t>{};
+};
@@ -0,0 +1,167 @@
+#include <array>
+#include <random>
+#include <vector>
+#include "bitfilled/bitstream.hpp"
+#include "bitfilled/bits.hpp"
+#include "bitfilled/macros.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+struct slice_header : host_integer<std::uint16_t>
+{
+    BF_COPY_SUPERCLASS(slice_header);
+
+    BF_BITS(std::uint8_t, 9, 11) type;
+    BF_BITS(std::uint16_t, 0, 8) id;
+};
+
+/// @brief  Writes the bits one by one, as the reference.
+template <bit_order ORDER>
+void reference_write(std::vector<std::byte>& bytes, std::size_t& pos, std::uint64_t value,
+                     std::size_t width)
+{
+    for (std::size_t i = 0; i < width; ++i, ++pos)
+    {
+        const auto bit = (ORDER == bit_order::msb_first) ? ((value >> (width - 1 - i)) & 1)
+                                                         : ((value >> i) & 1);
+        const auto shift = (ORDER == bit_order::msb_first) ? (7 - (pos % 8)) : (pos % 8);
+        bytes[pos / 8] |= static_cast<std::byte>(bit << shift);
+    }
+}
+
+template <bit_order ORDER>
+struct order_type
+{
+    static constexpr auto order = ORDER;
+};
+
+const suite bitstream = []
+{
+    "bit_writer msb_first"_test = []
+    {
+        std::array<std::byte, 8> buffer{};
+        bit_writer writer{std::span{buffer}};
+        writer.write(0b101, 3);
+        writer.write(0b10011, 5);
+        writer.write(0xabc, 12);
+        writer.write(0x5, 4);
+        writer.write(1, 1);
+        expect(that % writer.position() == 25u);
+        expect(that % writer.flush() == 4u);
+        expect(bool(writer));
+        expect(buffer[0] == std::byte{0xb3});
+        expect(buffer[1] == std::byte{0xab});
+        expect(buffer[2] == std::byte{0xc5});
+        expect(buffer[3] == std::byte{0x80});
+
+        bit_reader reader{std::span<const std::byte>{buffer}};
+        expect(that % reader.read(3) == 0b101u);
+        expect(that % reader.read(5) == 0b10011u);
+        expect(that % reader.read(12) == 0xabcu);
+        expect(that % reader.read(4) == 0x5u);
+        expect(that % reader.read(1) == 1u);
+        expect(that % reader.remaining() == 39u);
+    };
+
+    "bit_writer lsb_first"_test = []
+    {
+        std::array<std::byte, 4> buffer{};
+        bit_writer<bit_order::lsb_first> writer{std::span{buffer}};
+        writer.write(0b101, 3);
+        writer.write(0b10011, 5);
+        writer.write(0xabc, 12);
+        expect(that % writer.flush() == 3u);
+        expect(buffer[0] == std::byte{0x9d});
+        expect(buffer[1] == std::byte{0xbc});
+        expect(buffer[2] == std::byte{0x0a});
+
+        bit_reader<bit_order::lsb_first> reader{std::span<const std::byte>{buffer}};
+        expect(that % reader.read(3) == 0b101u);
+        expect(that % reader.read(5) == 0b10011u);
+        expect(that % reader.read(12) == 0xabcu);
+    };
+
+    "bit stream layouts"_test = []
+    {
+        std::array<std::byte, 4> buffer{};
+        slice_header header{};
+        header.type = 5;
+        header.id = 0x123;
+        bit_writer writer{std::span{buffer}};
+        writer.write(0b1, 1);
+        writer.write<12>(header);
+        writer.align();
+        expect(that % writer.position() == 16u);
+        writer.flush();
+        expect(buffer[0] == std::byte{0xd9});
+        expect(buffer[1] == std::byte{0x18});
+
+        bit_reader reader{std::span<const std::byte>{buffer}};
+        reader.skip(1);
+        const auto decoded = reader.read<slice_header, 12>();
+        expect(that % decoded.type == 5);
+        expect(that % decoded.id == 0x123);
+    };
+
+    "bit stream round trip"_test = []<class TestType>
+    {
+        constexpr auto order = TestType::order;
+        std::mt19937_64 random{42};
+        std::vector<std::pair<std::uint64_t, std::size_t>> fields;
+        std::size_t bits = 0;
+        for (std::size_t i = 0; i < 1000; ++i)
+        {
+            const auto width = static_cast<std::size_t>(random() % 65);
+            const auto value =
+                (width == 64) ? random() : (random() & ((std::uint64_t{1} << width) - 1));
+            fields.emplace_back(value, width);
+            bits += width;
+        }
+
+        std::vector<std::byte> expected((bits + 7) / 8);
+        std::size_t pos = 0;
+        for (const auto& [value, width] : fields)
+        {
+            reference_write<order>(expected, pos, value, width);
+        }
+
+        std::vector<std::byte> buffer(expected.size());
+        bit_writer<order> writer{std::span{buffer}};
+        for (const auto& [value, width] : fields)
+        {
+            writer.write(value, width);
+        }
+        expect(that % writer.flush() == expected.size());
+        expect(bool(writer));
+        expect(buffer == expected);
+
+        bit_reader<order> reader{std::span<const std::byte>{buffer}};
+        bool same = true;
+        for (const auto& [value, width] : fields)
+        {
+            same = same and (reader.read(width) == value);
+        }
+        expect(same);
+        expect(bool(reader));
+        expect(that % reader.position() == bits);
+    } | std::tuple<order_type<bit_order::msb_first>, order_type<bit_order::lsb_first>>{};
+
+    "bit stream overrun"_test = []
+    {
+        std::array<std::byte, 3> buffer{std::byte{0xff}, std::byte{0xff}, std::byte{0xff}};
+        bit_reader reader{std::span<const std::byte>{buffer}};
+        expect(that % reader.read(20) == 0xfffffu);
+        expect(bool(reader));
+        expect(that % reader.read(8) == 0u);
+        expect(!reader);
+
+        bit_writer writer{std::span{buffer}};
+        writer.write(0x1234, 16);
+        writer.write(0x56789a, 24);
+        writer.flush();
+        expect(!writer);
+        expect(buffer[2] == std::byte{0x56});
+    };
+};
@@ -0,0 +1,249 @@
+// Paired implementations of the same field accesses: bitfilled fields, native bit fields
+// and manual shift/mask code. The functions are named cg_<case>__<variant>,
+// all variants of a case shall compile to the same instructions (see compare.py).
+#include <cstdint>
+#include <cstring>
+#include "bitfilled.hpp"
+#include "bitfilled/record.hpp"
+
+using namespace bitfilled;
+
+namespace
+{
+struct host_reg : host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(host_reg);
+
+    BF_BITS(std::uint32_t, 3, 9) field;
+    BF_BITS(std::int32_t, 12, 19) signed_field;
+    BF_BITS(bool, 31) flag;
+};
+
+struct native_reg
+{
+    std::uint32_t : 3;
+    std::uint32_t field : 7;
+    std::uint32_t : 2;
+    std::int32_t signed_field : 8;
+    std::uint32_t : 11;
+    bool flag : 1;
+};
+
+struct mm_reg : BF_MMREG(std::uint32_t, rw)
+{
+    BF_COPY_SUPERCLASS(mm_reg)
+
+    BF_MMREGBITS(std::uint32_t, rw, 3, 9) field;
+    BF_MMREGBITS(std::int32_t, rw, 12, 19) signed_field;
+};
+
+template <std::endian ENDIAN, std::size_t SIZE>
+struct packed_reg : packed_integer<ENDIAN, SIZE>
+{
+    using superclass = packed_integer<ENDIAN, SIZE>;
+    BF_COPY_SUPERCLASS(packed_reg);
+    using bf_ops = typename superclass::bf_ops;
+
+    BF_BITS(std::uint32_t, 3, 9) field;
+    BF_BITS(bool, 21, 21) flag;
+};
+
+struct record_header : packed_record<std::endian::big, 40>
+{
+    BF_COPY_SUPERCLASS(record_header);
+
+    BF_BITS(std::uint32_t, 288, 307) flow_label;
+};
+
+template <std::endian ENDIAN, std::size_t SIZE>
+std::uint32_t manual_packed_load(const std::uint8_t* bytes)
+{
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < SIZE; ++i)
+    {
+        const auto shift = (ENDIAN == std::endian::little) ? (i * 8) : ((SIZE - 1 - i) * 8);
+        value |= static_cast<std::uint32_t>(bytes[i]) << shift;
+    }
+    return value;
+}
+} // namespace
+
+extern "C"
+{
+    // host_integer
+
+    std::uint32_t cg_host_get__bitfilled(const host_reg& reg) { return reg.field; }
+    std::uint32_t cg_host_get__native(const native_reg& reg) { return reg.field; }
+    std::uint32_t cg_host_get__manual(const std::uint32_t& reg) { return (reg >> 3) & 0x7fu; }
+
+    void cg_host_set__bitfilled(host_reg& reg, std::uint32_t v) { reg.field = v; }
+    void cg_host_set__native(native_reg& reg, std::uint32_t v) { reg.field = v & 0x7fu; }
+    void cg_host_set__manual(std::uint32_t& reg, std::uint32_t v)
+    {
+        reg = (reg & ~(0x7fu << 3)) | ((v & 0x7fu) << 3);
+    }
+
+    std::int32_t cg_host_get_signed__bitfilled(const host_reg& reg) { return reg.signed_field; }
+    std::int32_t cg_host_get_signed__native(const native_reg& reg) { return reg.signed_field; }
+    std::int32_t cg_host_get_signed__manual(const std::uint32_t& reg)
+    {
+        return static_cast<std::int32_t>(reg << 12) >> 24;
+    }
+
+    void cg_host_set_signed__bitfilled(host_reg& reg, std::int32_t v) { reg.signed_field = v; }
+    void cg_host_set_signed__native(native_reg& reg, std::int32_t v) { reg.signed_field = v; }
+    void cg_host_set_signed__manual(std::uint32_t& reg, std::int32_t v)
+    {
+        reg = (reg & ~(0xffu << 12)) | ((static_cast<std::uint32_t>(v) & 0xffu) << 12);
+    }
+
+    bool cg_host_get_flag__bitfilled(const host_reg& reg) { return reg.flag; }
+    bool cg_host_get_flag__native(const native_reg& reg) { return reg.flag; }
+    bool cg_host_get_flag__manual(const std::uint32_t& reg) { return (reg >> 31) != 0; }
+
+    bool cg_host_match__bitfilled(const host_reg& reg)
+    {
+        return match(reg, field<&host_reg::field> = 5, field<&host_reg::flag> = true);
+    }
+    bool cg_host_match__native(const native_reg& reg) { return (reg.field == 5) and reg.flag; }
+    bool cg_host_match__manual(const std::uint32_t& reg)
+    {
+        return (reg & ((0x7fu << 3) | (1u << 31))) == ((5u << 3) | (1u << 31));
+    }
+
+    // mmreg, volatile access
+
+    std::uint32_t cg_mmreg_get__bitfilled(const volatile mm_reg& reg) { return reg.field; }
+    std::uint32_t cg_mmreg_get__manual(const volatile std::uint32_t& reg)
+    {
+        return (reg >> 3) & 0x7fu;
+    }
+
+    bool cg_mmreg_match__bitfilled(const volatile mm_reg& reg)
+    {
+        return match(reg, field<&mm_reg::field> = 5, field<&mm_reg::signed_field> = -1);
+    }
+    bool cg_mmreg_match__manual(const volatile std::uint32_t& reg)
+    {
+        return (reg & ((0x7fu << 3) | (0xffu << 12))) == ((5u << 3) | (0xffu << 12));
+    }
+
+    void cg_mmreg_set__bitfilled(volatile mm_reg& reg, std::uint32_t v) { reg.field = v; }
+    void cg_mmreg_set__manual(volatile std::uint32_t& reg, std::uint32_t v)
+    {
+        reg = (reg & ~(0x7fu << 3)) | ((v & 0x7fu) << 3);
+    }
+
+    void cg_mmreg_build__bitfilled(volatile mm_reg& reg)
+    {
+        reg = build<mm_reg>(field<&mm_reg::field> = 5, field<&mm_reg::signed_field> = -1);
+    }
+    void cg_mmreg_build__manual(volatile std::uint32_t& reg) { reg = (5u << 3) | (0xffu << 12); }
+
+    std::int32_t cg_mmreg_get_signed__bitfilled(const volatile mm_reg& reg)
+    {
+        return reg.signed_field;
+    }
+    std::int32_t cg_mmreg_get_signed__manual(const volatile std::uint32_t& reg)
+    {
+        return static_cast<std::int32_t>(reg << 12) >> 24;
+    }
+
+    // packed_integer, both endiannesses
+
+    std::uint32_t cg_packed_le4_get__bitfilled(const packed_reg<std::endian::little, 4>& reg)
+    {
+        return reg.field;
+    }
+    std::uint32_t cg_packed_le4_get__manual(const std::uint8_t* bytes)
+    {
+        // only the two bytes holding the field are loaded
+        std::uint16_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        return (value >> 3) & 0x7fu;
+    }
+
+    std::uint32_t cg_packed_be4_get__bitfilled(const packed_reg<std::endian::big, 4>& reg)
+    {
+        return reg.field;
+    }
+    std::uint32_t cg_packed_be4_get__manual(const std::uint8_t* bytes)
+    {
+        return (manual_packed_load<std::endian::big, 4>(bytes) >> 3) & 0x7fu;
+    }
+
+    std::uint32_t cg_packed_le3_get__bitfilled(const packed_reg<std::endian::little, 3>& reg)
+    {
+        return reg.field;
+    }
+    std::uint32_t cg_packed_le3_get__manual(const std::uint8_t* bytes)
+    {
+        return (manual_packed_load<std::endian::little, 3>(bytes) >> 3) & 0x7fu;
+    }
+
+    std::uint32_t cg_packed_be3_get__bitfilled(const packed_reg<std::endian::big, 3>& reg)
+    {
+        return reg.field;
+    }
+    std::uint32_t cg_packed_be3_get__manual(const std::uint8_t* bytes)
+    {
+        return (manual_packed_load<std::endian::big, 3>(bytes) >> 3) & 0x7fu;
+    }
+
+    void cg_packed_le4_set__bitfilled(packed_reg<std::endian::little, 4>& reg, std::uint32_t v)
+    {
+        reg.field = v;
+    }
+    void cg_packed_le4_set__manual(std::uint8_t* bytes, std::uint32_t v)
+    {
+        std::uint16_t value;
+        std::memcpy(&value, bytes, sizeof(value));
+        value = static_cast<std::uint16_t>((value & ~(0x7fu << 3)) | ((v & 0x7fu) << 3));
+        std::memcpy(bytes, &value, sizeof(value));
+    }
+
+    void cg_packed_be4_set__bitfilled(packed_reg<std::endian::big, 4>& reg, std::uint32_t v)
+    {
+        reg.field = v;
+    }
+    void cg_packed_be4_set__manual(std::uint8_t* bytes, std::uint32_t v)
+    {
+        auto value = manual_packed_load<std::endian::big, 4>(bytes);
+        value = (value & ~(0x7fu << 3)) | ((v & 0x7fu) << 3);
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            bytes[i] = static_cast<std::uint8_t>(value >> ((3 - i) * 8));
+        }
+    }
+
+    // single byte fields of packed_integer are accessed as one byte
+
+    bool cg_packed_be4_flag_get__bitfilled(const packed_reg<std::endian::big, 4>& reg)
+    {
+        return reg.flag;
+    }
+    bool cg_packed_be4_flag_get__manual(const std::uint8_t* bytes)
+    {
+        return ((bytes[1] >> 5) & 1u) != 0;
+    }
+
+    void cg_packed_le4_flag_set__bitfilled(packed_reg<std::endian::little, 4>& reg, bool v)
+    {
+        reg.flag = v;
+    }
+    void cg_packed_le4_flag_set__manual(std::uint8_t* bytes, bool v)
+    {
+        bytes[2] = static_cast<std::uint8_t>((bytes[2] & ~(1u << 5)) | (unsigned(v) << 5));
+    }
+
+    // packed_record fields load only their bytes
+
+    std::uint32_t cg_record_be40_get__bitfilled(const record_header& header)
+    {
+        return header.flow_label;
+    }
+    std::uint32_t cg_record_be40_get__manual(const std::uint8_t* bytes)
+    {
+        return manual_packed_load<std::endian::big, 3>(bytes + 1) & 0xfffffu;
+    }
+}
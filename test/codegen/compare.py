@@ -0,0 +1,128 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MPL-2.0
+"""
+Compares the machine code of the bitfilled field accesses with their native bit field
+and manual shift/mask equivalents.
+
+The functions of the object file are grouped by the cg_<case>__<variant> naming scheme.
+For each case the bitfilled variant must not have more instructions than the best reference
+variant, and when the counts are equal, its instruction sequence must match a reference,
+unless the case is listed in the whitelist.
+"""
+import argparse
+import re
+import subprocess
+import sys
+from collections import defaultdict
+
+FUNCTION_RE = re.compile(r"^[0-9a-f]+ <(cg_\w+?)__(\w+)>:$")
+INSTRUCTION_RE = re.compile(r"^\s*[0-9a-f]+:\s+(.*)$")
+SUBJECT = "bitfilled"
+IGNORED_MNEMONICS = ("nop", "endbr", "int3", "hlt", "ud2")
+
+
+def normalize(instruction):
+    """Removes the parts of an instruction that don't depend on the code generation."""
+    instruction = instruction.split("#")[0].split("//")[0].split(";")[0]
+    instruction = re.sub(r"<[^>]*>", "", instruction)
+    instruction = re.sub(r"\s+", " ", instruction).strip()
+    tokens = instruction.split(" ")
+    # strip prefixes used for padding only
+    while tokens and tokens[0] in ("data16", "cs", "ds", "rex", "rex.W"):
+        tokens = tokens[1:]
+    if not tokens:
+        return None
+    mnemonic = tokens[0]
+    if mnemonic.startswith(IGNORED_MNEMONICS) or instruction == "xchg %ax,%ax":
+        return None
+    return " ".join(tokens)
+
+
+def disassemble(objdump, objects):
+    """Returns the normalized instructions of each function: {case: {variant: [...]}}"""
+    cases = defaultdict(dict)
+    for obj in objects:
+        output = subprocess.run(
+            [objdump, "-d", "--no-show-raw-insn", obj],
+            check=True,
+            capture_output=True,
+            text=True,
+        ).stdout
+        current = None
+        for line in output.splitlines():
+            match = FUNCTION_RE.match(line)
+            if match:
+                current = []
+                cases[match.group(1)][match.group(2)] = current
+                continue
+            match = INSTRUCTION_RE.match(line)
+            if match and current is not None:
+                instruction = normalize(match.group(1))
+                if instruction:
+                    current.append(instruction)
+            elif not line.strip():
+                current = None
+    return cases
+
+
+def read_whitelist(path):
+    """Returns the cases whose instruction sequences may differ (with equal counts)."""
+    if not path:
+        return set()
+    with open(path, encoding="utf-8") as file:
+        return {line.split("#")[0].strip() for line in file} - {""}
+
+
+def listing(instructions):
+    return "\n".join("    " + instruction for instruction in instructions)
+
+
+def compare(cases, whitelist):
+    failures = 0
+    for case, variants in sorted(cases.items()):
+        subject = variants.get(SUBJECT)
+        references = {name: code for name, code in variants.items() if name != SUBJECT}
+        if subject is None or not references:
+            print(f"{case}: missing {SUBJECT} or reference variant")
+            failures += 1
+            continue
+        best = min(len(code) for code in references.values())
+        if len(subject) > best:
+            verdict = f"FAIL ({len(subject)} instructions instead of {best})"
+        elif len(subject) < best:
+            verdict = f"ok (better, {len(subject)} instructions instead of {best})"
+        elif subject in references.values():
+            verdict = "ok"
+        elif case in whitelist:
+            verdict = "ok (whitelisted sequence)"
+        else:
+            verdict = "FAIL (different instruction sequence)"
+        print(f"{case}: {verdict}")
+        if verdict.startswith("FAIL"):
+            failures += 1
+            for name, code in [(SUBJECT, subject)] + sorted(references.items()):
+                print(f"  {name}:\n{listing(code)}")
+    stale = whitelist - set(cases)
+    for case in sorted(stale):
+        print(f"{case}: whitelisted, but not found")
+    return failures + len(stale)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("objects", nargs="+", help="the compiled object files")
+    parser.add_argument("--objdump", default="objdump", help="the objdump executable")
+    parser.add_argument("--whitelist", help="the file listing the tolerated cases")
+    args = parser.parse_args()
+
+    cases = disassemble(args.objdump, args.objects)
+    if not cases:
+        print("no cg_<case>__<variant> functions found")
+        return 1
+    failures = compare(cases, read_whitelist(args.whitelist))
+    print(f"{len(cases)} cases, {failures} failures")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,145 @@
+#include <vector>
+#include "bitfilled.hpp"
+#include "bitfilled/column.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+namespace
+{
+enum class kind : std::uint8_t
+{
+    NONE = 0,
+    SMALL = 1,
+    LARGE = 2,
+    HUGE = 3,
+};
+
+struct record : host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(record);
+
+    BF_BITS(bool, 0) valid;
+    BF_BITS(kind, 1, 2) size_kind;
+    BF_BITS(std::int32_t, 3, 9) delta;
+    BF_BITS(std::int16_t, 16, 31) offset;
+};
+
+// a signed owner, whose own sign bit belongs to a field
+struct signed_record : host_integer<std::int32_t>
+{
+    BF_COPY_SUPERCLASS(signed_record);
+
+    BF_BITS(std::int8_t, 0, 4) low;
+    BF_BITS(std::int16_t, 20, 31) high;
+};
+
+struct packed_sample : packed_integer<std::endian::big, 3>
+{
+    BF_COPY_SUPERCLASS(packed_sample);
+
+    BF_BITS(std::uint8_t, 4, 11) id;
+    BF_BITS(std::int8_t, 12, 17) delta;
+};
+
+std::vector<record> make_records(std::size_t count)
+{
+    std::vector<record> records(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        records[i] = static_cast<std::uint32_t>(i * 0x9e3779b9u);
+    }
+    return records;
+}
+} // namespace
+
+const suite column = []
+{
+    "extract_column"_test = []
+    {
+        const auto records = make_records(37);
+        std::vector<std::uint8_t> valid_bytes(records.size());
+        std::vector<kind> kinds(records.size());
+        std::vector<std::int32_t> deltas(records.size());
+        std::vector<std::int16_t> offsets(records.size());
+
+        extract_column(std::span{records}, &record::valid, std::span{valid_bytes});
+        extract_column(std::span{records}, &record::size_kind, std::span{kinds});
+        extract_column(std::span{records}, &record::delta, std::span{deltas});
+        extract_column(std::span{records}, &record::offset, std::span{offsets});
+
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            const auto& rec = records[i];
+            mismatches += (valid_bytes[i] != rec.valid) or (kinds[i] != rec.size_kind) or
+                          (deltas[i] != rec.delta) or (offsets[i] != rec.offset);
+        }
+        expect(that % mismatches == 0u);
+        expect(that % deltas[1] == 55);
+        expect(that % offsets[1] == -25033);
+    };
+
+    "extract_column signed owner"_test = []
+    {
+        std::vector<signed_record> records(19);
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            records[i].low = static_cast<std::int8_t>(static_cast<int>(i) - 9);
+            records[i].high = static_cast<std::int16_t>(static_cast<int>(i) * 200 - 1800);
+        }
+        std::vector<int> lows(records.size());
+        std::vector<int> highs(records.size());
+        extract_column(std::span{records}, &signed_record::low, std::span{lows});
+        extract_column(std::span{records}, &signed_record::high, std::span{highs});
+
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            mismatches += (lows[i] != static_cast<int>(i) - 9) or
+                          (highs[i] != static_cast<int>(i) * 200 - 1800);
+        }
+        expect(that % mismatches == 0u);
+        expect(that % lows[0] == -9);
+        expect(that % highs[0] == -1800);
+    };
+
+    "scatter_column"_test = []
+    {
+        auto records = make_records(37);
+        const auto original = records;
+        std::vector<std::int32_t> deltas(records.size());
+        for (std::size_t i = 0; i < deltas.size(); ++i)
+        {
+            deltas[i] = static_cast<std::int32_t>(i) - 18;
+        }
+        scatter_column(std::span{records}, &record::delta, std::span{deltas});
+
+        std::size_t mismatches = 0;
+        for (std::size_t i = 0; i < records.size(); ++i)
+        {
+            mismatches += (records[i].delta != deltas[i]) or
+                          ((records[i] & ~0x3f8u) != (original[i] & ~0x3f8u));
+        }
+        expect(that % mismatches == 0u);
+    };
+
+    "column packed_integer"_test = []
+    {
+        std::vector<packed_sample> records(3);
+        const std::int8_t deltas[]{-32, 31, -1};
+        const std::uint8_t ids[]{0x12, 0xff, 0};
+        scatter_column(std::span{records}, &packed_sample::delta, std::span{deltas});
+        scatter_column(std::span{records}, &packed_sample::id, std::span{ids});
+        expect(that % records[0] == 0x02'0120u);
+        expect(that % records[2] == 0x03'f000u);
+
+        std::int32_t out[3]{};
+        extract_column(std::span<const packed_sample>{records}, &packed_sample::delta,
+                       std::span{out});
+        expect(that % out[0] == -32);
+        expect(that % out[1] == 31);
+        expect(that % out[2] == -1);
+    };
+};
@@ -0,0 +1,106 @@
+// Each case misuses the API, and must be rejected by a static_assert of the library.
+// Without a case defined, the file must compile, which verifies the common declarations.
+#include "bitfilled.hpp"
+#include "bitfilled/async.hpp"
+#include "bitfilled/atomic_ops.hpp"
+#include "bitfilled/setclr_alias_ops.hpp"
+#include "bitfilled/view.hpp"
+
+using namespace bitfilled;
+
+namespace misuse
+{
+struct a_reg : host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(a_reg)
+
+    BF_BITS(std::uint8_t, 0, 7) x;
+    BF_BITSET(std::uint8_t, 4, 2, 8) nibbles BF_BITSET_POSTFIX;
+};
+// a register with the same integer type and operations, but another layout
+struct b_reg : host_integer<std::uint32_t>
+{
+    BF_COPY_SUPERCLASS(b_reg)
+
+    BF_BITS(std::uint8_t, 8, 15) y;
+};
+// two atomic owners with the same integer type and operations
+struct d_state : host_integer<std::uint32_t, atomic<>>
+{
+    BF_COPY_SUPERCLASS(d_state)
+
+    BF_BITS(std::uint8_t, 0, 7) phase;
+};
+struct e_state : host_integer<std::uint32_t, atomic<>>
+{
+    BF_COPY_SUPERCLASS(e_state)
+
+    BF_BITS(std::uint8_t, 8, 15) count;
+};
+// two registers with the same set / clear / toggle aliases
+struct f_gpio : BF_MMREG(std::uint32_t, rw, setclr_alias<4, 8, 12>)
+{
+    BF_COPY_SUPERCLASS(f_gpio)
+
+    BF_MMREGBITS(bool, rw, 0) enable;
+};
+struct g_gpio : BF_MMREG(std::uint32_t, rw, setclr_alias<4, 8, 12>)
+{
+    BF_COPY_SUPERCLASS(g_gpio)
+
+    BF_MMREGBITS(bool, rw, 1) ready;
+};
+// the registers of two devices at the same bus address
+struct h_reg : BF_ASYNCREG(std::uint8_t, rw, 0x01)
+{
+    BF_MMREGBITS(bool, rw, 0) on;
+};
+struct i_reg : BF_ASYNCREG(std::uint8_t, rw, 0x01)
+{
+    BF_MMREGBITS(bool, rw, 1) off;
+};
+// a packed integer with bitfields, which cannot be created in a byte buffer by itself
+struct c_flags : packed_integer<std::endian::big, 2>
+{
+    BF_COPY_SUPERCLASS(c_flags)
+
+    BF_BITS(bool, 15) z;
+};
+
+void misuse(a_reg& a, [[maybe_unused]] b_reg& b)
+{
+    modify(a, field<&a_reg::x> = 1);
+#if defined(MODIFY_FOREIGN_FIELD)
+    modify(a, field<&b_reg::y> = 0x22);
+#elif defined(READ_FOREIGN_FIELD)
+    [[maybe_unused]] auto [y] = read(a, &b_reg::y);
+#elif defined(ASSIGN_FIELD_SET)
+    modify(a, field<&a_reg::nibbles> = 1);
+#elif defined(SET_ITEM_OUT_OF_RANGE)
+    a.nibbles.set<2>(1);
+#elif defined(GET_ITEM_OUT_OF_RANGE)
+    [[maybe_unused]] auto item = a.nibbles.get<2>();
+#elif defined(VIEW_NON_IMPLICIT_LIFETIME)
+    std::byte buffer[2]{};
+    [[maybe_unused]] packed_view<c_flags> view{std::span{buffer}};
+#elif defined(ATOMIC_READ_FOREIGN_FIELD)
+    const d_state state{};
+    [[maybe_unused]] auto [count] = read(state, std::memory_order_acquire, &e_state::count);
+#elif defined(ATOMIC_WAIT_FOREIGN_FIELD)
+    const d_state state{};
+    [[maybe_unused]] auto count = wait<&e_state::count>(state, 0);
+#elif defined(TOGGLE_FOREIGN_FIELD)
+    auto& gpio = reinterpret_cast<volatile f_gpio&>(a);
+    toggle(gpio, &g_gpio::ready);
+#elif defined(MATCH_FOREIGN_FIELD)
+    [[maybe_unused]] bool matched = match(a, field<&b_reg::y> = 0x22);
+#elif defined(ANY_SET_FOREIGN_FIELD)
+    [[maybe_unused]] bool set = any_set(a, &b_reg::y);
+#elif defined(BUILD_FOREIGN_FIELD)
+    [[maybe_unused]] constexpr auto value = build<a_reg>(field<&b_reg::y> = 0x22);
+#elif defined(ASYNC_MODIFY_FOREIGN_FIELD)
+    h_reg reg;
+    [[maybe_unused]] auto task = async_modify(reg, field<&i_reg::off> = true);
+#endif
+}
+} // namespace misuse
@@ -1,3 +1,4 @@
+#include <vector>
 #include "bitfilled/integer.hpp"
 #include "bitfilled/bits.hpp"
 #include "bitfilled/macros.hpp"
@@ -12,6 +13,56 @@ struct endian_type
     static constexpr auto endianness = ENDIAN;
 };
 
+/// @brief  Checks the runtime storage layout and conversion against a bytewise reference.
+template <std::size_t SIZE, typename T>
+bool check_storage(T value, std::endian endianness)
+{
+    const integer_storage<SIZE> storage{value, endianness};
+    const auto wide = static_cast<std::int64_t>(value);
+    bool result = true;
+    for (std::size_t i = 0; i < SIZE; ++i)
+    {
+        const auto shift = static_cast<int>(std::min<std::size_t>(i, 7) * 8);
+        const auto byte = static_cast<std::uint8_t>(
+            (i < 8) ? ((wide >> shift) & 0xff) : ((wide < 0) ? 0xff : 0));
+        const auto pos = (endianness == std::endian::little) ? i : (SIZE - 1 - i);
+        result = result and (storage[pos] == byte);
+    }
+    // the value is only preserved if it fits in the storage
+    const auto bits = std::min(SIZE, sizeof(T)) * 8;
+    const auto mask = (bits >= 64) ? ~std::uint64_t{} : ((std::uint64_t{1} << bits) - 1);
+    const auto expected = static_cast<std::uint64_t>(wide) & mask;
+    const auto actual = static_cast<std::uint64_t>(storage.template to_integral<T>(endianness));
+    return result and ((actual & mask) == expected);
+}
+
+/// @brief  Checks the array conversions against the conversions of the single integers.
+template <std::endian ENDIAN, std::size_t SIZE, typename T>
+bool check_array_conversion()
+{
+    using packed = packed_integer<ENDIAN, SIZE, T>;
+    // covers whole groups of integers and a partial one
+    std::vector<T> values(sizeof(std::uint64_t) * 3 + 5);
+    std::uint64_t x = 0x9e37'79b9'7f4a'7c15u;
+    for (auto& value : values)
+    {
+        x = x * 6364136223846793005u + 1442695040888963407u;
+        value = static_cast<T>(x >> 17);
+    }
+    std::vector<packed> packed_values(values.size());
+    from_native(std::span{values}, std::span{packed_values});
+    std::vector<T> converted(values.size());
+    to_native(std::span{packed_values}, std::span{converted});
+    bool same = true;
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        const packed single{values[i]};
+        same = same and (packed_values[i].as_array() == single.as_array()) and
+               (converted[i] == static_cast<T>(single));
+    }
+    return same;
+}
+
 template <std::endian ENDIAN, std::size_t SIZE, typename T = sized_unsigned_t<std::bit_ceil(SIZE)>>
 struct packed_integer_with_bfs : packed_integer<ENDIAN, SIZE, T>
 {
@@ -25,6 +76,32 @@ struct packed_integer_with_bfs : packed_integer<ENDIAN, SIZE, T>
     BF_BITS(unsigned, 0, 15) halfword;
 };
 
+template <std::endian ENDIAN>
+struct packed_header : packed_integer<ENDIAN, 3, std::uint32_t>
+{
+    using base_type = packed_integer<ENDIAN, 3, std::uint32_t>;
+    using base_type::operator=;
+#ifdef _MSC_VER
+    using base_type::_get_field;
+    using base_type::_set_field;
+    using base_type::_get_item;
+    using base_type::_set_item;
+#endif
+    using bf_ops = base_type::bf_ops;
+    BF_BITS(bool, 0, 0) flag;
+    BF_BITS(unsigned, 3, 9) straddling;
+    BF_BITS(std::int8_t, 12, 15) nibble;
+    BF_BITSET(std::uint8_t, 2, 4, 16) pairs BF_BITSET_POSTFIX;
+};
+
+struct wide_word : host_integer<std::uint64_t>
+{
+    BF_COPY_SUPERCLASS(wide_word);
+
+    BF_BITS(std::uint64_t, 8, 47) middle;
+    BF_BITS(std::uint64_t, 0, 63) all;
+};
+
 const suite integer = []
 {
     "integer_storage"_test = []<class TestType>
@@ -84,6 +161,65 @@ const suite integer = []
 #endif
     } | std::tuple<endian_type<std::endian::little>, endian_type<std::endian::big>>{};
 
+    "integer_storage runtime"_test = []<class TestType>
+    {
+        constexpr auto e = TestType::endianness;
+        for (const std::int64_t value : {std::int64_t{0}, std::int64_t{0x7f}, std::int64_t{-1},
+                                         std::int64_t{-0x123456}, std::int64_t{0x0123456789abcdef},
+                                         std::int64_t{-0x0123456789abcdef}})
+        {
+            expect(check_storage<1>(static_cast<std::int8_t>(value), e));
+            expect(check_storage<3>(static_cast<std::int32_t>(value), e));
+            expect(check_storage<3>(static_cast<std::uint32_t>(value), e));
+            expect(check_storage<5>(value, e));
+            expect(check_storage<5>(static_cast<std::int16_t>(value), e));
+            expect(check_storage<6>(static_cast<std::uint64_t>(value), e));
+            expect(check_storage<7>(static_cast<std::int32_t>(value), e));
+            expect(check_storage<8>(value, e));
+            expect(check_storage<12>(value, e));
+        }
+
+        // signed values read back with sign extension from the storage size
+        const integer_storage<3> s3{0x80'0000u, e};
+        expect(s3.to_integral<std::int32_t>(e) == -0x80'0000);
+        const integer_storage<6> s6{0x8000'0000'0001u, e};
+        expect(s6.to_integral<std::int64_t>(e) == -0x7fff'ffff'ffff);
+    } | std::tuple<endian_type<std::endian::little>, endian_type<std::endian::big>>{};
+
+    "packed_integer arrays"_test = []<class TestType>
+    {
+        using packed = packed_integer<TestType::endianness, 3, std::int32_t>;
+        std::vector<std::int32_t> values(37);
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = (static_cast<std::int32_t>(i) - 18) * 0x3579;
+        }
+        std::vector<packed> packed_values(values.size());
+        from_native(std::span{values}, std::span{packed_values});
+        expect(packed_values[36] == 18 * 0x3579);
+        expect(packed_values[0] == -18 * 0x3579);
+
+        std::vector<std::int64_t> converted(values.size());
+        to_native(std::span{packed_values}, std::span{converted});
+        bool same = true;
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            same = same and (converted[i] == values[i]);
+        }
+        expect(same);
+    } | std::tuple<endian_type<std::endian::little>, endian_type<std::endian::big>>{};
+
+    "packed_integer arrays of odd sizes"_test = []<class TestType>
+    {
+        constexpr auto e = TestType::endianness;
+        expect(check_array_conversion<e, 3, std::int32_t>());
+        expect(check_array_conversion<e, 3, std::uint32_t>());
+        expect(check_array_conversion<e, 3, std::int64_t>());
+        expect(check_array_conversion<e, 5, std::int64_t>());
+        expect(check_array_conversion<e, 6, std::uint64_t>());
+        expect(check_array_conversion<e, 7, std::int64_t>());
+    } | std::tuple<endian_type<std::endian::little>, endian_type<std::endian::big>>{};
+
     "packed_integer_bits"_test = []<class TestType>
     {
         packed_integer_with_bfs<TestType::endianness, 4> pus4{};
@@ -94,4 +230,44 @@ const suite integer = []
         pus4 = 0x12345678;
         expect(pus4.halfword == 0x5678);
     } | std::tuple<endian_type<std::endian::little>, endian_type<std::endian::big>>{};
-};
\ No newline at end of file
+
+    "packed_integer bytewise fields"_test = []<class TestType>
+    {
+        constexpr auto little = TestType::endianness == std::endian::little;
+        // the storage index of the value's Nth byte
+        constexpr auto at = [](std::size_t n) { return little ? n : (2 - n); };
+
+        packed_header<TestType::endianness> header{};
+        header = 0xa55aa5u;
+        header.flag = false;
+        expect(that % header.as_array()[at(0)] == 0xa4);
+        expect(that % header.as_array()[at(1)] == 0x5a);
+        expect(that % header.as_array()[at(2)] == 0xa5);
+        expect(!header.flag);
+
+        header.straddling = 0x7fu;
+        expect(that % std::uint32_t(header) == 0xa55bfcu);
+        expect(that % unsigned(header.straddling) == 0x7fu);
+
+        header.nibble = -2;
+        expect(that % std::int8_t(header.nibble) == -2);
+        expect(that % header.as_array()[at(1)] == 0xeb);
+
+        header.pairs[3] = 0;
+        header.pairs[0] = 2;
+        expect(that % std::uint8_t(header.pairs[0]) == 2);
+        expect(that % std::uint8_t(header.pairs[1]) == 1);
+        expect(that % header.as_array()[at(2)] == 0x26);
+        expect(that % std::uint32_t(header) == 0x26ebfcu);
+    } | std::tuple<endian_type<std::endian::little>, endian_type<std::endian::big>>{};
+
+    "host_integer wide bits"_test = []
+    {
+        wide_word word{};
+        word.all = 0x1122334455667788ull;
+        word.middle = 0xffffffffffull;
+        expect(that % std::uint64_t(word) == 0x1122ffffffffff88ull);
+        expect(that % std::uint64_t(word.middle) == 0xffffffffffull);
+        expect(that % std::uint64_t(word.all) == 0x1122ffffffffff88ull);
+    };
+};
@@ -0,0 +1,139 @@
+#include <csignal>
+#include <thread>
+#include <pthread.h>
+#include <sys/socket.h>
+#include "bitfilled.hpp"
+#include "bitfilled/mapped_device.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+struct fpga_regs
+{
+    struct id : BF_MMREG(std::uint32_t, r)
+    {
+        BF_COPY_SUPERCLASS(id)
+
+        BF_MMREGBITS(std::uint16_t, r, 0, 15) revision;
+        BF_MMREGBITS(std::uint16_t, r, 16, 31) vendor;
+    };
+    struct control : BF_MMREG(std::uint32_t, rw)
+    {
+        BF_COPY_SUPERCLASS(control)
+
+        BF_MMREGBITS(bool, rw, 0) start;
+        BF_MMREGBITS(std::uint8_t, rw, 8, 15) channel;
+    };
+
+    id ID;
+    control CTRL;
+};
+
+/// @brief  Creates an anonymous file standing in for the device's register region.
+static int register_file(std::size_t size)
+{
+    const int fd = ::memfd_create("bitfilled-test", MFD_CLOEXEC);
+    if ((fd >= 0) and (::ftruncate(fd, static_cast<off_t>(size)) != 0))
+    {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+const suite mapped_device_suite = []
+{
+    "mapped_device registers"_test = []
+    {
+        const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        // the registers are located at an unaligned offset of the second page
+        const std::size_t offset = page_size + 0x40;
+        const int fd = register_file(2 * page_size);
+        expect((fd >= 0) >> fatal);
+        const std::uint32_t id = 0x10ee0003;
+        expect((::pwrite(fd, &id, sizeof(id), static_cast<off_t>(offset)) == sizeof(id)) >> fatal);
+
+        mapped_device<fpga_regs> device(::dup(fd), offset);
+        expect((bool(device) and !device.error()) >> fatal);
+        expect(that % std::uint16_t(device->ID.vendor) == 0x10ee);
+        expect(that % std::uint16_t(device->ID.revision) == 3);
+
+        modify(device->CTRL, field<&fpga_regs::control::start> = true,
+               field<&fpga_regs::control::channel> = 7);
+        std::uint32_t ctrl{};
+        expect(::pread(fd, &ctrl, sizeof(ctrl), static_cast<off_t>(offset + 4)) == sizeof(ctrl));
+        expect(that % ctrl == 0x0701u);
+        ::close(fd);
+
+        mapped_device<fpga_regs> moved = std::move(device);
+        expect(bool(moved));
+        expect(!device);
+    };
+
+    "mapped_device errors"_test = []
+    {
+        mapped_device<fpga_regs> device("/nonexistent/uio0");
+        expect(!device);
+        expect(device.error() == std::errc::no_such_file_or_directory);
+
+        // the error moves with the device
+        mapped_device<fpga_regs> moved = std::move(device);
+        expect(moved.error() == std::errc::no_such_file_or_directory);
+        expect(!device.error());
+    };
+
+    "mapped_device interrupts"_test = []
+    {
+        int events[2]{};
+        expect((::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, events) == 0) >> fatal);
+        mapped_device<fpga_regs> device(register_file(sizeof(fpga_regs)), 0, events[0]);
+        expect(bool(device) >> fatal);
+
+        // the driver enables the interrupt, as with UIO irqcontrol
+        expect(device.enable_interrupt());
+        std::int32_t enable{};
+        expect(::read(events[1], &enable, sizeof(enable)) == sizeof(enable));
+        expect(that % enable == 1);
+
+        expect(!device.wait_interrupt(std::chrono::milliseconds(1)));
+        expect(device.error() == std::errc::timed_out);
+
+        // the device signals the interrupt count, as the UIO driver does
+        std::thread irq([fd = events[1]]
+        {
+            const std::uint32_t count = 42;
+            expect(::write(fd, &count, sizeof(count)) == sizeof(count));
+        });
+        const auto count = device.wait_interrupt();
+        irq.join();
+        expect((count.has_value()) >> fatal);
+        expect(that % *count == 42u);
+
+        // a signal doesn't end the waiting
+        struct sigaction action{};
+        struct sigaction previous{};
+        action.sa_handler = [](int) {};
+        ::sigaction(SIGUSR1, &action, &previous);
+        std::thread signaler([waiter = ::pthread_self(), fd = events[1]]
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            ::pthread_kill(waiter, SIGUSR1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            const std::uint32_t next = 43;
+            expect(::write(fd, &next, sizeof(next)) == sizeof(next));
+        });
+        const auto resumed = device.wait_interrupt();
+        signaler.join();
+        ::sigaction(SIGUSR1, &previous, nullptr);
+        expect((resumed.has_value()) >> fatal);
+        expect(that % *resumed == 43u);
+
+        // a partial interrupt count is an error
+        const std::uint16_t partial = 1;
+        expect(::write(events[1], &partial, sizeof(partial)) == sizeof(partial));
+        ::close(events[1]);
+        expect(!device.wait_interrupt());
+        expect(device.error() == std::errc::io_error);
+    };
+};
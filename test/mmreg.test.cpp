@@ -44,6 +44,27 @@ struct mmr : public bitfilled::mmreg<std::uint8_t, ACCESS>
 };
 static_assert(sizeof(mmr<access::rw>) == sizeof(std::uint8_t));
 
+struct mmr_set : BF_MMREG(std::uint32_t, rw)
+{
+    BF_COPY_SUPERCLASS(mmr_set)
+
+    BF_MMREGBITSET(std::uint8_t, rw, 4, 6, 2) nibbles;
+};
+
+struct mmr_status : BF_MMREG(std::uint32_t, r)
+{
+    BF_COPY_SUPERCLASS(mmr_status)
+
+    BF_MMREGBITSET(bool, r, 1, 2, 30) flags;
+};
+
+struct mmr_trigger : BF_MMREG(std::uint32_t, w)
+{
+    BF_COPY_SUPERCLASS(mmr_trigger)
+
+    BF_MMREGBITSET(bool, w, 1, 2, 30) flags;
+};
+
 const suite mmreg = []
 {
     "mmregs assignment"_test = []
@@ -99,6 +120,13 @@ const suite mmreg = []
         expect(rw2 == (3 << rw2.integer.offset()));
     };
 
+    "mmregs field masks"_test = []
+    {
+        expect(decltype(memory_mapped_reg::boolean)::mask() == true);
+        expect(mmr<access::rw>::boolean_t::mask() == true);
+        expect(mmr<access::rw>::integer_t::mask() == 0x1f);
+    };
+
     "mmregs reference"_test = []
     {
         std::uint8_t v[static_cast<unsigned>(access::rw) + 1]{};
@@ -119,4 +147,41 @@ const suite mmreg = []
         wo = 0xaa;
         wo = ro;
     };
+
+    "mmregs set"_test = []
+    {
+        std::uint32_t values[3]{0x00000003, 0xffffffff, 0};
+        auto& rw = reinterpret_cast<volatile mmr_set&>(values[0]);
+        auto& ro = reinterpret_cast<volatile mmr_status&>(values[1]);
+        auto& wo = reinterpret_cast<volatile mmr_trigger&>(values[2]);
+
+        rw.nibbles.assign({1, 2, 3, 4, 5, 6});
+        expect(that % values[0] == 0x0195'0c87u);
+        rw.nibbles.set<5>(0xf);
+        expect(that % rw.nibbles.get<5>() == 0xf);
+        expect(that % rw.nibbles.find(4) == 3u);
+        std::uint8_t sum = 0;
+        for (auto nibble : rw.nibbles)
+        {
+            sum = static_cast<std::uint8_t>(sum + nibble);
+        }
+        expect(that % sum == 1 + 2 + 3 + 4 + 5 + 0xf);
+        for (auto it = rw.nibbles.rbegin(); it != rw.nibbles.rend(); ++it)
+        {
+            *it = 0xa;
+        }
+        expect(that % values[0] == 0x02aa'aaabu);
+        rw.nibbles.fill(0);
+        expect(that % values[0] == 0x0000'0003u);
+
+        expect(that % ro.flags.count(true) == 2u);
+        expect(that % ro.flags.find(false) == ro.flags.size());
+        expect(that % ro.flags.get<1>() == true);
+
+        // a write-only set cannot be read back, the other bits are written as zero
+        wo.flags.assign({true, false});
+        expect(that % values[2] == 0x40000000u);
+        wo.flags[1] = true;
+        expect(that % values[2] == 0x80000000u);
+    };
 };
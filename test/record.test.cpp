@@ -0,0 +1,132 @@
+#include "bitfilled/record.hpp"
+#include "bitfilled/bits.hpp"
+#include "bitfilled/macros.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+struct ipv6_header : packed_record<std::endian::big, 40>
+{
+    BF_COPY_SUPERCLASS(ipv6_header);
+
+    BF_BITS(std::uint8_t, 316, 319) version;
+    BF_BITS(std::uint8_t, 308, 315) traffic_class;
+    BF_BITS(std::uint32_t, 288, 307) flow_label;
+    BF_BITS(std::uint16_t, 272, 287) payload_length;
+    BF_BITS(std::uint8_t, 264, 271) next_header;
+    BF_BITS(std::uint8_t, 256, 263) hop_limit;
+    BF_BITSET(std::uint64_t, 64, 2, 128) source BF_BITSET_POSTFIX;
+    BF_BITS(std::uint64_t, 64, 127) destination_prefix;
+    BF_BITS(std::uint64_t, 0, 63) destination_iid;
+};
+
+struct telemetry : packed_record<std::endian::little, 32>
+{
+    BF_COPY_SUPERCLASS(telemetry);
+
+    BF_BITS(std::uint16_t, 60, 75) straddling;
+    BF_BITS(std::int32_t, 100, 131) offset;
+    BF_BITSET(std::uint16_t, 12, 10, 136) samples BF_BITSET_POSTFIX;
+};
+
+struct short_record : packed_record<std::endian::little, 9>
+{
+    BF_COPY_SUPERCLASS(short_record);
+
+    BF_BITSET(std::uint8_t, 7, 10, 2) items BF_BITSET_POSTFIX;
+};
+
+/// @brief  Reads the bits of a little endian byte array one by one, as the reference.
+template <std::size_t SIZE>
+std::uint64_t reference_bits(const std::array<std::uint8_t, SIZE>& bytes, std::size_t pos,
+                             std::size_t width)
+{
+    std::uint64_t value = 0;
+    for (std::size_t i = 0; i < width; ++i)
+    {
+        const auto bit = (bytes[(pos + i) / 8] >> ((pos + i) % 8)) & 1;
+        value |= static_cast<std::uint64_t>(bit) << i;
+    }
+    return value;
+}
+
+const suite record_suite = []
+{
+    "packed_record big endian header"_test = []
+    {
+        const std::uint8_t packet[40] = {
+            0x60, 0x0a, 0xbc, 0xde, 0x00, 0x20, 0x11, 0x40, // version ... hop limit
+            0x20, 0x01, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, // source
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, //
+            0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // destination
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, //
+        };
+        ipv6_header header{packet};
+        expect(that % header.version == 6);
+        expect(that % header.traffic_class == 0);
+        expect(that % header.flow_label == 0xabcdeu);
+        expect(that % header.payload_length == 0x20);
+        expect(that % header.next_header == 17);
+        expect(that % header.hop_limit == 64);
+        expect(that % header.source[1] == 0x20010db800000000ull);
+        expect(that % header.source[0] == 1ull);
+        expect(that % header.destination_prefix == 0xfe80000000000000ull);
+        expect(that % header.destination_iid == 1ull);
+
+        header.traffic_class = 0xb8;
+        header.flow_label = 0x12345u;
+        header.source[0] = 0x0123456789abcdefull;
+        header.destination_iid = 0xfedcba9876543210ull;
+        const auto& bytes = header.as_array();
+        expect(that % bytes[0] == 0x6b);
+        expect(that % bytes[1] == 0x81);
+        expect(that % bytes[2] == 0x23);
+        expect(that % bytes[3] == 0x45);
+        expect(that % bytes[15] == 0x00);
+        expect(that % bytes[16] == 0x01);
+        expect(that % bytes[23] == 0xef);
+        expect(that % bytes[31] == 0x00);
+        expect(that % bytes[32] == 0xfe);
+        expect(that % bytes[39] == 0x10);
+        expect(that % header.payload_length == 0x20);
+        expect(that % header.source[1] == 0x20010db800000000ull);
+    };
+
+    "packed_record fields across words"_test = []
+    {
+        telemetry record{};
+        record.straddling = 0xa5c3;
+        record.offset = -123456;
+        for (std::size_t i = 0; i < record.samples.size(); ++i)
+        {
+            record.samples[i] = static_cast<std::uint16_t>(0x100 * i + 0x5a);
+        }
+        const auto& bytes = record.as_array();
+        expect(that % reference_bits(bytes, 60, 16) == 0xa5c3u);
+        expect(that % reference_bits(bytes, 100, 32) == static_cast<std::uint32_t>(-123456));
+        expect(that % record.straddling == 0xa5c3);
+        expect(that % record.offset == -123456);
+        for (std::size_t i = 0; i < record.samples.size(); ++i)
+        {
+            expect(that % reference_bits(bytes, 136 + i * 12, 12) == 0x100 * i + 0x5a);
+            expect(that % record.samples[i] == 0x100 * i + 0x5a);
+        }
+    };
+
+    "packed_record items at the end"_test = []
+    {
+        short_record record{};
+        for (std::size_t i = 0; i < record.items.size(); ++i)
+        {
+            record.items[i] = static_cast<std::uint8_t>(0x41 + i);
+        }
+        const auto& bytes = record.as_array();
+        for (std::size_t i = 0; i < record.items.size(); ++i)
+        {
+            expect(that % reference_bits(bytes, 2 + i * 7, 7) == 0x41 + i);
+            expect(that % record.items[i] == 0x41 + i);
+        }
+        expect(that % reference_bits(bytes, 0, 2) == 0u);
+    };
+};
@@ -0,0 +1,170 @@
+#include "bitfilled.hpp"
+#include "bitfilled/remote.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+/// a power management chip, with 8-bit registers and a 16-bit big endian counter
+struct pmic_t : remote_device<pmic_t>
+{
+    using remote_device::remote_device;
+
+    struct STATUS_t : BF_REMOTEREG(std::uint8_t, r, 0x00)
+    {
+        BF_COPY_SUPERCLASS(STATUS_t)
+
+        BF_MMREGBITS(bool, r, 0) power_good;
+        BF_MMREGBITS(std::uint8_t, r, 4, 7) fault;
+    };
+    struct CTRL_t : BF_REMOTEREG(std::uint8_t, rw, 0x01)
+    {
+        BF_COPY_SUPERCLASS(CTRL_t)
+
+        BF_MMREGBITS(bool, rw, 0) enable;
+        BF_MMREGBITS(std::uint8_t, rw, 2, 5) mode;
+    };
+    struct VOUT_t : BF_REMOTEREG(std::uint16_t, rw, 0x02)
+    {
+        BF_COPY_SUPERCLASS(VOUT_t)
+
+        BF_MMREGBITS(std::uint16_t, rw, 0, 11) millivolts;
+        BF_MMREGBITS(bool, rw, 15) ramp;
+    };
+    struct COUNT_t : BF_REMOTEREG(std::uint16_t, r, 0x04)
+    {
+        BF_COPY_SUPERCLASS(COUNT_t)
+    };
+    struct TRIGGER_t : BF_REMOTEREG(std::uint8_t, w, 0x08)
+    {
+        BF_COPY_SUPERCLASS(TRIGGER_t)
+
+        BF_MMREGBITS(bool, w, 0) start;
+    };
+
+    [[no_unique_address]] STATUS_t STATUS;
+    [[no_unique_address]] CTRL_t CTRL;
+    [[no_unique_address]] VOUT_t VOUT;
+    [[no_unique_address]] COUNT_t COUNT;
+    [[no_unique_address]] TRIGGER_t TRIGGER;
+};
+
+static_assert(sizeof(pmic_t) == sizeof(bitfilled::detail::remote_bus));
+
+/// @brief  The transactions of the log, as (write, address, size) tuples.
+static std::vector<std::tuple<bool, std::uint32_t, std::size_t>> transactions(
+    const loopback_transport& bus)
+{
+    std::vector<std::tuple<bool, std::uint32_t, std::size_t>> result;
+    for (const auto& t : bus.log())
+    {
+        result.emplace_back(t.write, t.address, t.size);
+    }
+    return result;
+}
+
+const suite remote_suite = []
+{
+    using transaction_list = std::vector<std::tuple<bool, std::uint32_t, std::size_t>>;
+
+    "remote register fields"_test = []
+    {
+        loopback_transport bus{16};
+        pmic_t pmic{bus};
+        auto memory = bus.memory();
+        memory[0] = std::byte{0x51};
+        memory[4] = std::byte{0x12};
+        memory[5] = std::byte{0x34};
+
+        expect(pmic.STATUS.power_good);
+        expect(that % pmic.STATUS.fault == 5);
+        expect(that % static_cast<std::uint16_t>(pmic.COUNT) == 0x1234);
+
+        pmic.CTRL.mode = 9;
+        pmic.VOUT.millivolts = 3300;
+        pmic.TRIGGER.start = true;
+        expect(memory[1] == std::byte{0x24});
+        expect(memory[2] == std::byte{0x0c});
+        expect(memory[3] == std::byte{0xe4});
+        expect(memory[8] == std::byte{0x01});
+        expect(that % pmic.VOUT.millivolts == 3300);
+
+        // each field access is a transaction (two for a read-modify-write)
+        expect(transactions(bus) == transaction_list{{false, 0, 1},
+                                                     {false, 0, 1},
+                                                     {false, 4, 2},
+                                                     {false, 1, 1},
+                                                     {true, 1, 1},
+                                                     {false, 2, 2},
+                                                     {true, 2, 2},
+                                                     {true, 8, 1},
+                                                     {false, 2, 2}});
+        expect(bool(pmic));
+    };
+
+    "remote modify and read"_test = []
+    {
+        loopback_transport bus{16};
+        pmic_t pmic{bus, std::endian::little};
+        modify(pmic.VOUT, field<&pmic_t::VOUT_t::millivolts> = 1800,
+               field<&pmic_t::VOUT_t::ramp> = true);
+        expect(bus.memory()[2] == std::byte{0x08});
+        expect(bus.memory()[3] == std::byte{0x87});
+        const auto [millivolts, ramp] =
+            read(pmic.VOUT, &pmic_t::VOUT_t::millivolts, &pmic_t::VOUT_t::ramp);
+        expect(that % millivolts == 1800);
+        expect(ramp);
+        expect(that % bus.log().size() == 3u);
+    };
+
+    "remote batch bursts"_test = []
+    {
+        loopback_transport bus{16};
+        pmic_t pmic{bus};
+        bus.memory()[0] = std::byte{0x01};
+        {
+            remote_batch batch{pmic};
+            batch.prefetch(pmic.STATUS, pmic.COUNT);
+            expect(pmic.STATUS.power_good);
+            pmic.CTRL.enable = true;
+            pmic.CTRL.mode = 3;
+            pmic.VOUT.millivolts = 1200;
+            // the prefetched values are updated by the writes
+            expect(that % pmic.CTRL.mode == 3);
+            expect(that % bus.log().size() == 1u);
+        }
+        expect(bus.memory()[1] == std::byte{0x0d});
+        expect(bus.memory()[2] == std::byte{0x04});
+        expect(bus.memory()[3] == std::byte{0xb0});
+        // the contiguous writes are merged into a burst, but a register isn't written twice in one
+        expect(transactions(bus) ==
+               transaction_list{{false, 0, 6}, {true, 1, 1}, {true, 1, 3}});
+
+        bus.clear_log();
+        {
+            remote_batch batch{pmic};
+            pmic.CTRL = 0;
+            pmic.TRIGGER = 1;
+            // a read outside of the prefetched range sends the pending writes first
+            expect(that % static_cast<std::uint16_t>(pmic.COUNT) == 0);
+            pmic.VOUT = 0;
+        }
+        expect(transactions(bus) == transaction_list{
+                                        {true, 1, 1}, {true, 8, 1}, {false, 4, 2}, {true, 2, 2}});
+    };
+
+    "remote transport errors"_test = []
+    {
+        loopback_transport bus{4};
+        pmic_t pmic{bus};
+        bus.memory()[0] = std::byte{0xff};
+        expect(that % pmic.STATUS.fault == 0xf);
+        expect(bool(pmic));
+        pmic.TRIGGER.start = true;
+        expect(!pmic);
+        expect(pmic.error() == std::errc::bad_address);
+        expect(that % static_cast<std::uint16_t>(pmic.COUNT) == 0);
+        pmic.clear_error();
+        expect(bool(pmic));
+    };
+};
@@ -0,0 +1,104 @@
+#include <array>
+#include "bitfilled.hpp"
+#include "bitfilled/setclr_alias_ops.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+// the register is followed by its set, clear and toggle aliases (as on NXP i.MX)
+using imx_alias = setclr_alias<4, 8, 12>;
+
+struct gpio_ctrl : BF_MMREG(std::uint32_t, rw, imx_alias)
+{
+    BF_COPY_SUPERCLASS(gpio_ctrl)
+
+    BF_MMREGBITS(bool, rw, 0) enable;
+    BF_MMREGBITS(std::uint8_t, rw, 4, 7) mode;
+    BF_MMREGBITSET(bool, rw, 1, 8, 16) outputs;
+    BF_MMREGBITSET(std::uint8_t, rw, 2, 4, 24) drive;
+};
+
+struct host_ctrl : host_integer<std::uint16_t, setclr_alias<2, 4, 6>>
+{
+    BF_COPY_SUPERCLASS(host_ctrl);
+
+    BF_BITS(std::uint8_t, 0, 2) level;
+};
+
+/// @brief  The register and its aliases, as the stores are observed on the bus.
+struct alias_block
+{
+    std::uint32_t reg;
+    std::uint32_t set;
+    std::uint32_t clr;
+    std::uint32_t tgl;
+};
+
+const suite setclr_alias_suite = []
+{
+    "setclr_alias fields"_test = []
+    {
+        alias_block block{0xffffffff, 0, 0, 0};
+        auto& ctrl = reinterpret_cast<volatile gpio_ctrl&>(block.reg);
+
+        // single bit fields are written with a single store
+        ctrl.enable = true;
+        expect(that % block.set == 0x1u);
+        expect(that % block.clr == 0u);
+        ctrl.enable = false;
+        expect(that % block.clr == 0x1u);
+
+        // wider fields clear their zero bits, then set their one bits
+        block = {0xffffffff, 0, 0, 0};
+        ctrl.mode = 0x9;
+        expect(that % block.clr == 0x60u);
+        expect(that % block.set == 0x90u);
+        // the register itself is neither read nor written
+        expect(that % block.reg == 0xffffffffu);
+        expect(that % std::uint8_t(ctrl.mode) == 0xf);
+
+        block = {0, 0, 0, 0};
+        ctrl.mode = 0;
+        expect(that % block.clr == 0xf0u);
+        expect(that % block.set == 0u);
+    };
+
+    "setclr_alias fieldsets"_test = []
+    {
+        alias_block block{};
+        auto& ctrl = reinterpret_cast<volatile gpio_ctrl&>(block.reg);
+        ctrl.outputs[3] = true;
+        expect(that % block.set == 0x80000u);
+        ctrl.outputs[5] = false;
+        expect(that % block.clr == 0x200000u);
+
+        block = {};
+        ctrl.drive[2] = 2;
+        expect(that % block.clr == 0x10000000u);
+        expect(that % block.set == 0x20000000u);
+    };
+
+    "setclr_alias transactions"_test = []
+    {
+        alias_block block{};
+        auto& ctrl = reinterpret_cast<volatile gpio_ctrl&>(block.reg);
+        modify(ctrl, field<&gpio_ctrl::enable> = true, field<&gpio_ctrl::mode> = 0x3);
+        expect(that % block.set == 0x31u);
+        expect(that % block.clr == 0xc0u);
+
+        toggle(ctrl, &gpio_ctrl::enable, &gpio_ctrl::mode);
+        expect(that % block.tgl == 0xf1u);
+        expect(that % block.reg == 0u);
+    };
+
+    "setclr_alias host_integer"_test = []
+    {
+        std::array<std::uint16_t, 4> block{};
+        auto& ctrl = reinterpret_cast<host_ctrl&>(block[0]);
+        ctrl.level = 5;
+        expect(that % block[1] == 0x5u);
+        expect(that % block[2] == 0x2u);
+        expect(that % block[0] == 0u);
+    };
+};
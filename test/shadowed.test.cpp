@@ -0,0 +1,115 @@
+#include "bitfilled.hpp"
+#include "bitfilled/shadowed_ops.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+struct timer_ctrl : BF_MMREG(std::uint32_t, w, ::bitfilled::shadowed<struct timer_ctrl>)
+{
+    BF_COPY_SUPERCLASS(timer_ctrl)
+
+    BF_MMREGBITS(bool, w, 0) enable;
+    BF_MMREGBITS(std::uint8_t, w, 4, 7) mode;
+    BF_MMREGBITS(std::uint16_t, w, 16, 31) prescaler;
+    BF_MMREGBITSET(bool, w, 1, 4, 8) channels;
+};
+
+// unrelated registers with the same integer type and access have their own shadows
+struct a_ctrl : BF_MMREG(std::uint32_t, w, ::bitfilled::shadowed<struct a_ctrl>)
+{
+    BF_COPY_SUPERCLASS(a_ctrl)
+
+    BF_MMREGBITS(std::uint8_t, w, 0, 7) x;
+};
+struct b_data : BF_MMREG(std::uint32_t, w, ::bitfilled::shadowed<struct b_data>)
+{
+    BF_COPY_SUPERCLASS(b_data)
+
+    BF_MMREGBITS(std::uint8_t, w, 8, 15) y;
+};
+
+// the instances of a peripheral's register are keyed separately
+template <typename TKey>
+struct uart_ctrl : ::bitfilled::mmreg<std::uint16_t, access::w, ::bitfilled::shadowed<TKey>>
+{
+    using superclass = ::bitfilled::mmreg<std::uint16_t, access::w, ::bitfilled::shadowed<TKey>>;
+    BF_COPY_SUPERCLASS(uart_ctrl)
+    using bf_ops = typename superclass::bf_ops;
+
+    BF_MMREGBITS(bool, w, 0) enable;
+    BF_MMREGBITS(std::uint8_t, w, 8, 15) baud;
+};
+using uart1_ctrl = uart_ctrl<struct uart1>;
+using uart2_ctrl = uart_ctrl<struct uart2>;
+
+const suite shadowed = []
+{
+    "shadowed field writes"_test = []
+    {
+        std::uint32_t value = 0;
+        auto& reg = reinterpret_cast<volatile timer_ctrl&>(value);
+
+        reg.enable = true;
+        expect(that % value == 0x1u);
+        reg.mode = 5;
+        expect(that % value == 0x51u);
+        reg.prescaler = 0x1234;
+        expect(that % value == 0x12340051u);
+        reg.channels[2] = true;
+        expect(that % value == 0x12340451u);
+        reg.enable = false;
+        expect(that % value == 0x12340450u);
+
+        // the shadow can be read back without accessing the register
+        value = 0;
+        expect(that % timer_ctrl::bf_ops::shadow(reg) == 0x12340450u);
+        expect(that % extract<decltype(timer_ctrl::mode)>(timer_ctrl::bf_ops::shadow(reg)) == 5);
+    };
+
+    "shadowed whole writes"_test = []
+    {
+        std::uint32_t value = 0xffffffff;
+        auto& reg = reinterpret_cast<volatile timer_ctrl&>(value);
+
+        timer_ctrl::bf_ops::set_value(reg, 0x00010000u);
+        expect(that % value == 0x00010000u);
+        modify(reg, field<&timer_ctrl::enable> = true, field<&timer_ctrl::mode> = 3);
+        expect(that % value == 0x00010031u);
+        reg.prescaler = 2;
+        expect(that % value == 0x00020031u);
+    };
+
+    "shadowed distinct registers"_test = []
+    {
+        std::uint32_t a_value = 0;
+        std::uint32_t b_value = 0;
+        auto& a = reinterpret_cast<volatile a_ctrl&>(a_value);
+        auto& b = reinterpret_cast<volatile b_data&>(b_value);
+
+        a.x = 0x11;
+        b.y = 0x22;
+        expect(that % a_value == 0x11u);
+        expect(that % b_value == 0x2200u);
+        a.x = 0x33;
+        expect(that % a_value == 0x33u);
+        expect(that % b_value == 0x2200u);
+    };
+
+    "shadowed instances"_test = []
+    {
+        std::uint16_t values[2]{};
+        auto& uart1 = reinterpret_cast<volatile uart1_ctrl&>(values[0]);
+        auto& uart2 = reinterpret_cast<volatile uart2_ctrl&>(values[1]);
+
+        uart1.baud = 0x12;
+        uart2.baud = 0x34;
+        uart1.enable = true;
+        uart2.enable = true;
+        expect(that % values[0] == 0x1201);
+        expect(that % values[1] == 0x3401);
+        uart1.enable = false;
+        expect(that % values[0] == 0x1200);
+        expect(that % values[1] == 0x3401);
+    };
+};
@@ -0,0 +1,182 @@
+#include <array>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bitfilled.hpp"
+#include "bitfilled/simulated_ops.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+using uart_ops = simulated<>;
+using uart_bitband_ops = simulated<bitband<0x40000000>>;
+
+struct uart_status : BF_MMREG(std::uint32_t, r, uart_ops)
+{
+    BF_COPY_SUPERCLASS(uart_status)
+
+    BF_MMREGBITS(bool, r, 0) rx_ready;
+    BF_MMREGBITS(bool, r, 3) overrun;
+};
+
+struct uart_rx_data : BF_MMREG(std::uint32_t, r, uart_ops)
+{
+    BF_COPY_SUPERCLASS(uart_rx_data)
+
+    BF_MMREGBITS(std::uint8_t, r, 0, 7) value;
+};
+
+struct uart_tx_data : BF_MMREG(std::uint32_t, w, uart_ops)
+{
+    BF_COPY_SUPERCLASS(uart_tx_data)
+
+    BF_MMREGBITS(std::uint8_t, w, 0, 7) value;
+};
+
+struct uart_control : BF_MMREG(std::uint32_t, rw, uart_bitband_ops)
+{
+    BF_COPY_SUPERCLASS(uart_control)
+
+    BF_MMREGBITS(bool, rw, 0) enable;
+    BF_MMREGBITS(std::uint8_t, rw, 4, 7) prescaler;
+    BF_MMREGBITSET(bool, rw, 1, 4, 16) interrupts;
+};
+
+struct uart_control16 : BF_MMREG(std::uint16_t, rw, uart_bitband_ops)
+{
+    BF_COPY_SUPERCLASS(uart_control16)
+
+    BF_MMREGBITS(bool, rw, 9) parity;
+};
+
+struct uart_t
+{
+    uart_status SR;
+    uart_rx_data RDR;
+    uart_tx_data TDR;
+    uart_control CR1;
+    uart_control16 CR2;
+    uart_control16 CR3;
+};
+
+static_assert(bitband<0x40000000>::alias_address(0x40010008, 4) == 0x42200110);
+
+const suite simulated_suite = []
+{
+    "simulated plain memory"_test = []
+    {
+        std::array<std::uint32_t, 6> memory{};
+        auto& uart = reinterpret_cast<volatile uart_t&>(memory[0]);
+        // without a simulator, the registers are plain memory
+        uart.TDR.value = 0x5a;
+        expect(that % memory[2] == 0x5au);
+
+        simulator sim;
+        expect(simulator::active() == &sim);
+        // the simulator is only active on its own thread
+        simulator* other_active = &sim;
+        std::thread([&other_active] { other_active = simulator::active(); }).join();
+        expect(other_active == nullptr);
+        memory[1] = 0x1234;
+        expect(that % std::uint8_t(uart.RDR.value) == 0x34);
+        expect(!uart.SR.rx_ready);
+        uart.TDR.value = 0xa5;
+        expect(that % memory[2] == 0xa5u);
+    };
+
+    "simulated register models"_test = []
+    {
+        std::array<std::uint32_t, 6> memory{};
+        auto& uart = reinterpret_cast<volatile uart_t&>(memory[0]);
+        simulator sim;
+        std::deque<std::uint8_t> rx{'o', 'k'};
+        std::vector<std::uint8_t> tx;
+        // the status reflects the receive FIFO, the overrun flag is cleared on read
+        sim.attach(uart.SR, {.read = [&rx](std::uint64_t& stored)
+        {
+            const auto value = stored | (rx.empty() ? 0u : 1u);
+            stored &= ~std::uint64_t{0x8};
+            return value;
+        }});
+        sim.attach(uart.RDR, {.read = [&rx](std::uint64_t&)
+        {
+            const std::uint64_t value = rx.empty() ? 0 : rx.front();
+            if (!rx.empty())
+            {
+                rx.pop_front();
+            }
+            return value;
+        }});
+        sim.attach(uart.TDR, {.write = [&tx](std::uint64_t&, std::uint64_t value)
+        { tx.push_back(static_cast<std::uint8_t>(value)); }});
+
+        memory[0] = 0x8;
+        expect(uart.SR.overrun);
+        expect(!uart.SR.overrun);
+        std::string received;
+        while (uart.SR.rx_ready)
+        {
+            received.push_back(static_cast<char>(std::uint8_t(uart.RDR.value)));
+        }
+        expect(received == "ok");
+
+        uart.TDR.value = 'h';
+        uart.TDR.value = 'i';
+        expect(tx == std::vector<std::uint8_t>{'h', 'i'});
+        // the model doesn't store the written value
+        expect(that % memory[2] == 0u);
+    };
+
+    "simulated bit-band"_test = []
+    {
+        std::array<std::uint32_t, 6> memory{};
+        auto& uart = reinterpret_cast<volatile uart_t&>(memory[0]);
+        simulator sim;
+        sim.map(&uart, sizeof(uart), 0x40010000);
+        expect(that % simulator::bus_address(&uart.CR1) == 0x4001000cu);
+
+        uart.CR1.enable = true;
+        uart.CR1.interrupts[2] = true;
+        uart.CR1.prescaler = 0xa;
+        expect(that % memory[3] == 0x400a1u);
+        expect(uart.CR1.enable);
+        expect(uart.CR1.interrupts[2]);
+        expect(!uart.CR1.interrupts[1]);
+        uart.CR1.enable = false;
+        expect(that % memory[3] == 0x400a0u);
+
+        // the alias is translated to the register, the model sees a read-modify-write
+        std::vector<std::uint64_t> writes;
+        sim.attach(uart.CR3, {.write = [&writes](std::uint64_t& stored, std::uint64_t value)
+        {
+            writes.push_back(value);
+            stored = value;
+        }});
+        uart.CR2.parity = true;
+        uart.CR3.parity = true;
+        expect(that % memory[4] == 0x02000200u);
+        expect(writes == std::vector<std::uint64_t>{0x200});
+    };
+
+    "simulated transactions"_test = []
+    {
+        std::array<std::uint32_t, 6> memory{};
+        auto& uart = reinterpret_cast<volatile uart_t&>(memory[0]);
+        simulator sim;
+        std::size_t writes = 0;
+        sim.attach(uart.CR1, {.write = [&writes](std::uint64_t& stored, std::uint64_t value)
+        {
+            ++writes;
+            stored = value;
+        }});
+        modify(uart.CR1, field<&uart_control::prescaler> = 3, field<&uart_control::enable> = true);
+        expect(that % writes == 1u);
+        expect(that % memory[3] == 0x31u);
+        const auto [prescaler, enable] =
+            read(uart.CR1, &uart_control::prescaler, &uart_control::enable);
+        expect(that % prescaler == 3);
+        expect(enable);
+    };
+};
@@ -0,0 +1,174 @@
+#include <array>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+#include "bitfilled.hpp"
+#include "bitfilled/setclr_alias_ops.hpp"
+#include "bitfilled/traced_ops.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+struct test_sink
+{
+    static inline std::vector<trace_record> records{};
+    static void record(const trace_record& record) { records.push_back(record); }
+};
+
+struct traced_word : host_integer<std::uint32_t, traced<base, test_sink>>
+{
+    BF_COPY_SUPERCLASS(traced_word);
+
+    BF_BITS(std::uint8_t, 4, 11) level;
+    BF_BITS(std::int8_t, 12, 15) offset;
+    BF_BITSET(bool, 1, 4, 16) flags BF_BITSET_POSTFIX;
+};
+
+struct traced_cmd : BF_MMREG(std::uint16_t, w, ::bitfilled::traced<::bitfilled::base, test_sink>)
+{
+    BF_COPY_SUPERCLASS(traced_cmd)
+
+    BF_MMREGBITS(std::uint8_t, w, 0, 7) opcode;
+    BF_MMREGBITS(bool, w, 15) start;
+};
+
+// the register is followed by its set, clear and toggle aliases
+struct traced_alias_word : host_integer<std::uint32_t, traced<setclr_alias<4, 8, 12>, test_sink>>
+{
+    BF_COPY_SUPERCLASS(traced_alias_word);
+
+    BF_BITS(std::uint8_t, 4, 11) level;
+};
+static_assert(write_traits<bitband<0x40000000>>::stores_field(1));
+static_assert(!write_traits<bitband<0x40000000>>::stores_field(2));
+
+struct ring_word : host_integer<std::uint16_t, traced<base, trace_ring<4>>>
+{
+    BF_COPY_SUPERCLASS(ring_word);
+
+    BF_BITS(std::uint8_t, 0, 3) low;
+};
+
+static std::uintptr_t address_of(const volatile void* ptr)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr);
+}
+
+const suite traced_suite = []
+{
+    "traced fields"_test = []
+    {
+        test_sink::records.clear();
+        traced_word word{};
+        word.level = 0x5a;
+        word.offset = -2;
+        const std::uint8_t level = word.level;
+        word.flags[2] = true;
+        expect(that % level == 0x5a);
+        expect(that % std::uint32_t(word) == 0x4e5a0u);
+
+        const auto& records = test_sink::records;
+        expect((that % records.size() == 4u) >> fatal);
+        expect(records[0].kind == trace_kind::modify);
+        expect(that % records[0].address == address_of(&word));
+        expect(that % records[0].width == 4);
+        expect(that % records[0].first_bit == 4);
+        expect(that % records[0].last_bit == 11);
+        expect(that % records[0].value == 0x5au);
+        // the field bits are recorded, without sign extension
+        expect(that % records[1].value == 0xeu);
+        expect(records[2].kind == trace_kind::read);
+        expect(that % records[2].value == 0x5au);
+        expect(that % records[3].first_bit == 18);
+        expect(that % records[3].last_bit == 18);
+        expect(that % records[3].value == 1u);
+        expect(records[0].timestamp <= records[3].timestamp);
+    };
+
+    "traced whole values"_test = []
+    {
+        test_sink::records.clear();
+        traced_word word{};
+        modify(word, field<&traced_word::level> = 3, field<&traced_word::offset> = 1);
+        const auto [level] = read(word, &traced_word::level);
+        expect(that % level == 3);
+
+        const auto& records = test_sink::records;
+        expect((that % records.size() == 2u) >> fatal);
+        expect(records[0].kind == trace_kind::modify);
+        expect(that % records[0].first_bit == 4);
+        expect(that % records[0].last_bit == 15);
+        expect(that % records[0].value == 0x103u);
+        expect(records[1].kind == trace_kind::read);
+        expect(that % records[1].first_bit == 0);
+        expect(that % records[1].last_bit == 31);
+    };
+
+    "traced write-only register"_test = []
+    {
+        test_sink::records.clear();
+        std::uint16_t value = 0;
+        auto& cmd = reinterpret_cast<volatile traced_cmd&>(value);
+        cmd.opcode = 0x12;
+        cmd.start = true;
+        expect(that % value == 0x8000);
+
+        const auto& records = test_sink::records;
+        expect((that % records.size() == 2u) >> fatal);
+        expect(records[0].kind == trace_kind::write);
+        expect(records[1].kind == trace_kind::write);
+        expect(that % records[1].width == 2);
+        expect(that % records[1].first_bit == 15);
+        expect(that % records[1].address == address_of(&value));
+    };
+
+    "traced alias stores"_test = []
+    {
+        test_sink::records.clear();
+        std::array<std::uint32_t, 4> words{};
+        auto& word = reinterpret_cast<traced_alias_word&>(words[0]);
+        word.level = 0x0f;
+        modify(word, field<&traced_alias_word::level> = 0xf0);
+        expect(that % words[1] == 0xf00u);
+        expect(that % words[2] == 0x0f0u);
+
+        // the aliases are only stored to, the register isn't read
+        const auto& records = test_sink::records;
+        expect((that % records.size() == 2u) >> fatal);
+        expect(records[0].kind == trace_kind::write);
+        expect(records[1].kind == trace_kind::write);
+    };
+
+    "trace ring"_test = []
+    {
+        auto& ring = trace_ring<4>::local();
+        ring.clear();
+        ring_word word{};
+        for (std::uint8_t i = 0; i < 6; ++i)
+        {
+            word.low = i;
+        }
+        expect(that % ring.total() == 6u);
+        expect(that % ring.size() == 4u);
+
+        std::vector<std::uint64_t> values;
+        ring.for_each([&values](const trace_record& record) { values.push_back(record.value); });
+        expect(values == std::vector<std::uint64_t>{2, 3, 4, 5});
+
+        // each thread records into its own buffer
+        std::thread([] { ring_word other{}; other.low = 1; }).join();
+        expect(that % ring.total() == 6u);
+
+        std::FILE* file = std::tmpfile();
+        expect((file != nullptr) >> fatal);
+        ring.dump(file);
+        std::rewind(file);
+        std::string text(1024, '\0');
+        text.resize(std::fread(text.data(), 1, text.size(), file));
+        std::fclose(file);
+        expect(text.starts_with("timestamp,address,width,kind,first_bit,last_bit,value\n"));
+        expect(text.ends_with(",2,modify,0,3,0x5\n"));
+    };
+};
@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <array>
+#include "bitfilled.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+/// an integer type that counts the accesses to its storage
+struct counted_integer
+{
+    using superclass = counted_integer;
+    using value_type = std::uint32_t;
+    using bf_ops = base::bitfield_ops<counted_integer>;
+
+    static inline unsigned reads = 0;
+    static inline unsigned writes = 0;
+    static void reset_counters() { reads = writes = 0; }
+
+    constexpr counted_integer() = default;
+    constexpr counted_integer(value_type v) : raw_(v) {}
+    operator value_type() const
+    {
+        ++reads;
+        return raw_;
+    }
+    counted_integer& operator=(value_type v)
+    {
+        ++writes;
+        raw_ = v;
+        return *this;
+    }
+
+  private:
+    value_type raw_{};
+};
+
+struct control : counted_integer
+{
+    BF_COPY_SUPERCLASS(control)
+
+    BF_BITS(bool, 0) enable;
+    BF_BITS(std::uint8_t, 1, 3) mode;
+    BF_BITS(std::int32_t, 4, 7) trim;
+    BF_BITS(std::uint16_t, 16, 31) reload;
+    BF_BITSET(std::uint8_t, 2, 4, 8) levels;
+};
+
+struct host_control : host_integer<std::uint16_t>
+{
+    BF_COPY_SUPERCLASS(host_control)
+
+    BF_BITS(bool, 0) enable;
+    BF_BITS(std::uint8_t, 4, 7) mode;
+    BF_BITS(std::int32_t, 8, 15) trim;
+};
+
+struct packed_control : packed_integer<std::endian::big, 3>
+{
+    BF_COPY_SUPERCLASS(packed_control)
+
+    BF_BITS(bool, 0) enable;
+    BF_BITS(std::uint8_t, 4, 11) mode;
+    BF_BITS(std::uint16_t, 12, 23) length;
+};
+
+template <enum access ACCESS>
+struct control_reg : mmreg<std::uint32_t, ACCESS>
+{
+    using bf_ops = typename mmreg<std::uint32_t, ACCESS>::bf_ops;
+
+    BF_MMREGBITS(bool, w, 0) enable;
+    BF_MMREGBITS(std::uint8_t, w, 8, 15) prescaler;
+};
+
+struct memory_status : mmreg<std::uint32_t, access::r>
+{
+    BF_MMREGBITS(bool, r, 0) ready;
+    BF_MMREGBITS_TYPE(std::uint8_t, r, state_t, 8, 11) state;
+    BF_MMREGBITS(std::int8_t, r, 12, 15) error;
+};
+
+struct timer_periph
+{
+    struct CTRL_t : mmreg<std::uint32_t, access::rw>
+    {
+        BF_MMREGBITS(bool, rw, 0) enable;
+        BF_MMREGBITS(std::uint8_t, rw, 8, 15) prescaler;
+    } CTRL;
+    struct RELOAD_t : mmreg<std::uint32_t, access::w>
+    {
+        BF_MMREGBITS(std::uint16_t, w, 0, 15) value;
+    } RELOAD;
+};
+
+const suite transaction = []
+{
+    "modify counts accesses"_test = []
+    {
+        control var{0xffff0000};
+
+        counted_integer::reset_counters();
+        var.enable = true;
+        var.mode = 5;
+        var.trim = -2;
+        expect(that % counted_integer::reads == 3u);
+        expect(that % counted_integer::writes == 3u);
+
+        counted_integer::reset_counters();
+        modify(var, field<&control::enable> = false, field<&control::mode> = 2,
+               field<&control::trim> = -3);
+        expect(that % counted_integer::reads == 1u);
+        expect(that % counted_integer::writes == 1u);
+
+        expect(that % var.enable == false);
+        expect(that % var.mode == 2);
+        expect(that % var.trim == -3);
+        expect(that % var.reload == 0xffff);
+    };
+
+    "set bulk counts accesses"_test = []
+    {
+        control var{0x0000'5500};
+
+        counted_integer::reset_counters();
+        for (auto level : var.levels)
+        {
+            level = 2;
+        }
+        expect(that % counted_integer::reads == 4u);
+        expect(that % counted_integer::writes == 4u);
+
+        counted_integer::reset_counters();
+        var.levels.fill(3);
+        var.levels.assign({0, 1});
+        expect(that % counted_integer::reads == 2u);
+        expect(that % counted_integer::writes == 2u);
+
+        counted_integer::reset_counters();
+        expect(that % var.levels.count(3) == 2u);
+        expect(that % var.levels.find(1) == 1u);
+        expect(that % counted_integer::reads == 2u);
+        expect(that % counted_integer::writes == 0u);
+        expect(that % var == 0x0000'f400u);
+    };
+
+    "modify host_integer"_test = []
+    {
+        host_control var{0xffff};
+        modify(var, field<&host_control::mode> = 0, field<&host_control::trim> = -128);
+        expect(that % var == 0x800f);
+        expect(that % var.trim == -128);
+
+        // values are truncated to the field size
+        modify(var, field<&host_control::enable> = false, field<&host_control::mode> = 0x13);
+        expect(that % var == 0x803e);
+    };
+
+    "modify packed_integer"_test = []
+    {
+        packed_control var{};
+        modify(var, field<&packed_control::enable> = true, field<&packed_control::mode> = 0xab,
+               field<&packed_control::length> = 0x123);
+        expect(that % var == 0x123ab1u);
+        expect(var.as_array()[0] == 0x12);
+        expect(var.as_array()[1] == 0x3a);
+        expect(var.as_array()[2] == 0xb1);
+    };
+
+    "modify mmreg"_test = []
+    {
+        std::uint32_t values[2]{0xff0000ff, 0xff0000ff};
+        auto& rw = reinterpret_cast<volatile control_reg<access::rw>&>(values[0]);
+        auto& wo = reinterpret_cast<volatile control_reg<access::w>&>(values[1]);
+
+        modify(rw, field<&control_reg<access::rw>::enable> = false,
+               field<&control_reg<access::rw>::prescaler> = 0x42);
+        expect(that % values[0] == 0xff0042feu);
+
+        // a write-only register cannot be read back, the other fields are written as zero
+        modify(wo, field<&control_reg<access::w>::enable> = true,
+               field<&control_reg<access::w>::prescaler> = 0x42);
+        expect(that % values[1] == 0x00004201u);
+    };
+
+    "read counts accesses"_test = []
+    {
+        const control var{0x1234'00d5};
+
+        counted_integer::reset_counters();
+        auto [enable, mode, trim, reload] =
+            read(var, &control::enable, &control::mode, &control::trim, &control::reload);
+        expect(that % counted_integer::reads == 1u);
+        expect(that % counted_integer::writes == 0u);
+
+        static_assert(std::is_same_v<decltype(enable), bool>);
+        static_assert(std::is_same_v<decltype(trim), std::int32_t>);
+        expect(that % enable == true);
+        expect(that % mode == 2);
+        expect(that % trim == -3);
+        expect(that % reload == 0x1234);
+    };
+
+    "read mmreg"_test = []
+    {
+        std::uint32_t value = 0x0000a501;
+        const auto& reg = reinterpret_cast<volatile memory_status&>(value);
+
+        const auto [ready, state, error] =
+            read(reg, &memory_status::ready, &memory_status::state, &memory_status::error);
+        expect(that % ready == true);
+        expect(that % state == 5);
+        expect(that % error == -6);
+        expect(that % extract<memory_status::state_t>(value) == 5);
+    };
+
+    "match counts accesses"_test = []
+    {
+        const control var{0x1234'00d5};
+
+        counted_integer::reset_counters();
+        expect(match(var, field<&control::enable> = true, field<&control::trim> = -3));
+        expect(!match(var, field<&control::enable> = true, field<&control::mode> = 3));
+        expect(match(var, field<&control::reload> = 0x1234));
+        expect(that % counted_integer::reads == 3u);
+
+        counted_integer::reset_counters();
+        expect(any_set(var, &control::enable, &control::mode));
+        expect(!any_set(var, &control::levels));
+        expect(all_clear(var, &control::levels));
+        expect(!all_clear(var, &control::trim, &control::reload));
+        expect(that % counted_integer::reads == 4u);
+        expect(that % counted_integer::writes == 0u);
+    };
+
+    "match mmreg"_test = []
+    {
+        std::uint32_t value = 0x0000a501;
+        const auto& reg = reinterpret_cast<volatile memory_status&>(value);
+        expect(match(reg, field<&memory_status::ready> = true, field<&memory_status::error> = -6));
+        expect(!match(reg, field<&memory_status::ready> = false));
+        expect(any_set(reg, &memory_status::state));
+    };
+
+    "matching lookup"_test = []
+    {
+        const std::array<host_control, 4> table{0x0010, 0x0021, 0x0031, 0xff31};
+        const auto it = std::find_if(table.begin(), table.end(),
+                                     matching(field<&host_control::enable> = true,
+                                              field<&host_control::mode> = 3));
+        expect((it != table.end()) >> fatal);
+        expect(that % (it - table.begin()) == 2);
+        expect(that % std::count_if(table.begin(), table.end(),
+                                    matching(field<&host_control::trim> = 0)) == 3);
+    };
+
+    "build constant values"_test = []
+    {
+        constexpr auto value = build<host_control>(field<&host_control::enable> = true,
+                                                   field<&host_control::mode> = 5,
+                                                   field<&host_control::trim> = -2);
+        static_assert(value == 0xfe51);
+        static_assert(build<host_control>(0xffff, field<&host_control::mode> = 0) == 0xff0f);
+        static_assert(build<packed_control>(field<&packed_control::length> = 0x123) == 0x123000u);
+
+        control var{0xffff0000};
+        counted_integer::reset_counters();
+        var = build<control>(field<&control::enable> = true, field<&control::reload> = 0x55);
+        expect(that % counted_integer::reads == 0u);
+        expect(that % counted_integer::writes == 1u);
+        expect(that % var == 0x0055'0001u);
+    };
+
+    "constexpr transactions"_test = []
+    {
+        constexpr auto value = []() -> std::uint16_t
+        {
+            host_control v{0xffff};
+            modify(v, field<&host_control::mode> = 0, field<&host_control::trim> = -128);
+            return v;
+        }();
+        static_assert(value == 0x800f);
+        constexpr host_control var{value};
+        static_assert(std::get<1>(read(var, &host_control::enable, &host_control::trim)) == -128);
+        static_assert(match(var, field<&host_control::enable> = true));
+        static_assert(all_clear(var, &host_control::mode));
+
+        constexpr auto bytes = []
+        {
+            packed_control v{};
+            modify(v, field<&packed_control::mode> = 0xab, field<&packed_control::enable> = true);
+            return v.as_array();
+        }();
+        static_assert(bytes[0] == 0x00);
+        static_assert(bytes[1] == 0x0a);
+        static_assert(bytes[2] == 0xb1);
+    };
+
+    "register image"_test = []
+    {
+        constexpr register_image timer_init{
+            register_init<&timer_periph::RELOAD>(field<&timer_periph::RELOAD_t::value> = 999),
+            register_init<&timer_periph::CTRL>(0xff000000u,
+                                               field<&timer_periph::CTRL_t::enable> = true,
+                                               field<&timer_periph::CTRL_t::prescaler> = 0x42),
+        };
+        static_assert(timer_init.size() == 2);
+        static_assert(std::get<1>(timer_init.values).value == 0xff004201u);
+
+        std::uint32_t memory[2]{0x12345678, 0x12345678};
+        auto& periph = reinterpret_cast<volatile timer_periph&>(memory[0]);
+        timer_init.write(periph);
+        expect(that % memory[0] == 0xff004201u);
+        expect(that % memory[1] == 999u);
+    };
+};
@@ -152,5 +152,44 @@ suite variable_bits = []
         expect(that % var1.signs[1] == -2);
         expect(that % var1.signs[2] == -2);
     };
+
+    "variable set iteration"_test = []
+    {
+        eightbits var{0};
+        std::int32_t value = -1;
+        for (auto item : var.signs)
+        {
+            item = value--;
+        }
+        expect(that % var.signs[0] == -1);
+        expect(that % var.signs[1] == -2);
+        expect(that % var.signs[2] == 1);
+
+        const auto& cvar = var;
+        expect(that % std::distance(cvar.signs.begin(), cvar.signs.end()) == 3);
+        expect(that % *cvar.signs.rbegin() == 1);
+        expect(that % *std::next(cvar.signs.rbegin()) == -2);
+        auto found = std::find(cvar.signs.begin(), cvar.signs.end(), -2);
+        expect(that % (found - cvar.signs.begin()) == 1);
+        expect(that % cvar.signs.begin()[2] == 1);
+    };
+
+    "variable set bulk"_test = []
+    {
+        eightbits var{0x81};
+        var.signs.fill(-1);
+        expect(that % var == 0xff);
+        var.signs.assign({1, -2});
+        expect(that % var == 0xf3);
+        expect(that % var.signs.get<0>() == 1);
+        expect(that % var.signs.get<1>() == -2);
+        expect(that % var.signs.get<2>() == -1);
+        var.signs.set<2>(0);
+        expect(that % var == 0x93);
+        expect(that % var.signs.count(0) == 1u);
+        expect(that % var.signs.count(-1) == 0u);
+        expect(that % var.signs.find(-2) == 1u);
+        expect(that % var.signs.find(-1) == var.signs.size());
+    };
 #endif
 };
@@ -0,0 +1,89 @@
+#include <array>
+#include "bitfilled.hpp"
+#include "bitfilled/view.hpp"
+#include <boost/ut.hpp>
+
+using namespace bitfilled;
+using namespace boost::ut;
+
+namespace
+{
+struct ipv4_flags : packed_integer<std::endian::big, 2>
+{
+    BF_COPY_SUPERCLASS(ipv4_flags);
+
+    BF_BITS(bool, 14) dont_fragment;
+    BF_BITS(bool, 13) more_fragments;
+    BF_BITS(std::uint16_t, 0, 12) fragment_offset;
+};
+
+struct frame_header
+{
+    packed_integer<std::endian::big, 1> version;
+    packed_integer<std::endian::big, 3> length;
+    ipv4_flags flags;
+    packed_integer<std::endian::little, 4, std::int32_t> offset;
+};
+static_assert(sizeof(frame_header) == 10);
+
+template <std::size_t N>
+std::array<std::byte, N> make_bytes(std::initializer_list<unsigned> values)
+{
+    std::array<std::byte, N> bytes{};
+    std::size_t i = 0;
+    for (auto value : values)
+    {
+        bytes[i++] = static_cast<std::byte>(value);
+    }
+    return bytes;
+}
+} // namespace
+
+const suite view = []
+{
+    "packed_view"_test = []
+    {
+        // the header starts at an odd offset, after a one byte prefix
+        auto bytes = make_bytes<16>(
+            {0xee, 0x04, 0x01, 0x02, 0x03, 0x40, 0x12, 0xfe, 0xff, 0xff, 0xff, 0xaa, 0xbb});
+        const auto received = bytes;
+        const packed_view<frame_header> header(std::span{bytes}.subspan(1));
+        expect(static_cast<bool>(header));
+        expect(header->version == 4u);
+        expect(header->length == 0x010203u);
+        expect(header->flags.dont_fragment == true);
+        expect(header->flags.more_fragments == false);
+        expect(header->flags.fragment_offset == 0x12u);
+        expect((*header).offset == -2);
+        expect(header.tail().size() == 5u);
+        expect(header.tail()[0] == std::byte{0xaa});
+        expect(bytes == received);
+    };
+
+    "packed_view too short"_test = []
+    {
+        auto bytes = make_bytes<9>({});
+        const packed_view<frame_header> header(std::span{bytes});
+        expect(not header);
+        expect(header.tail().empty());
+    };
+
+    "packed_ref"_test = []
+    {
+        auto bytes = make_bytes<11>({});
+        const packed_ref<frame_header> header(std::span{bytes}.subspan(1));
+        expect(static_cast<bool>(header));
+        header->version = 6;
+        header->length = 0x123456;
+        header->flags.more_fragments = true;
+        header->flags.fragment_offset = 0x1abc;
+        header->offset = -0x100;
+        const auto expected =
+            make_bytes<11>({0, 0x06, 0x12, 0x34, 0x56, 0x3a, 0xbc, 0x00, 0xff, 0xff, 0xff});
+        expect(bytes == expected);
+        expect(header.tail().empty());
+
+        const packed_view<frame_header> readback = header;
+        expect(readback->flags.fragment_offset == 0x1abcu);
+    };
+};
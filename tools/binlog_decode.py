@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MPL-2.0
+"""
+Decodes the binary logs written by bitfilled::binlog (see binlog::flush()) into named fields,
+using the layout metadata of bitfilled::write_layouts() or of svd2mmregmap.py --layouts.
+Each record is printed on a separate line, as the layout name followed by the field values.
+"""
+import argparse
+import json
+import struct
+import sys
+
+MAGIC = 0x474C4642  # "BFLG"
+
+
+def layout_id(name):
+    """The FNV-1a hash of the layout name, as bitfilled::layout_id() computes it."""
+    value = 2166136261
+    for byte in name.encode():
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+
+def load_layouts(paths):
+    layouts = {}
+    for path in paths:
+        with open(path) as file:
+            for layout in json.load(file)["layouts"]:
+                layouts[layout.get("id", layout_id(layout["name"]))] = layout
+    return layouts
+
+
+def load_records(path, byteorder):
+    """Yields the (id, raw value) pairs of the records, chunk by chunk."""
+    prefix = "<" if byteorder == "little" else ">"
+    chunk_header, record_header = struct.Struct(prefix + "II"), struct.Struct(prefix + "IB")
+    with (sys.stdin.buffer if path == "-" else open(path, "rb")) as file:
+        data = file.read()
+    pos = 0
+    while pos < len(data):
+        magic, size = chunk_header.unpack_from(data, pos)
+        if magic != MAGIC:
+            raise ValueError(f"{path}: no chunk header at offset {pos}")
+        pos += chunk_header.size
+        end = pos + size
+        while pos < end:
+            id, value_size = record_header.unpack_from(data, pos)
+            pos += record_header.size
+            yield id, int.from_bytes(data[pos:pos + value_size], byteorder)
+            pos += value_size
+
+
+def field_value(raw, first_bit, width, kind):
+    value = (raw >> first_bit) & ((1 << width) - 1)
+    if kind == "signed" and value >> (width - 1):
+        value -= 1 << width
+    elif kind == "bool":
+        value = bool(value)
+    return value
+
+
+def decode(id, raw, layouts):
+    layout = layouts.get(id)
+    if layout is None:
+        return f"0x{id:08x} raw=0x{raw:x}"
+    values = []
+    for field in layout["fields"]:
+        items = [field_value(raw, field["first_bit"] + i * field["width"], field["width"],
+                             field["kind"]) for i in range(field.get("count", 1))]
+        values.append(f"{field['name']}={items[0] if len(items) == 1 else items}")
+    return " ".join([layout["name"]] + values)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("logs", nargs="*", default=["-"],
+                        help="the binary log files (default: stdin)")
+    parser.add_argument("--layouts", action="append", required=True,
+                        help="JSON file of the layout metadata (can be given multiple times)")
+    parser.add_argument("--endian", choices=("little", "big"), default="little",
+                        help="the byte order of the logging target")
+    args = parser.parse_args()
+
+    layouts = load_layouts(args.layouts)
+    for path in args.logs:
+        for id, raw in load_records(path, args.endian):
+            print(decode(id, raw, layouts))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 import argparse
+import json
 import pathlib
 from cmsis_svd import SVDParser
 from cmsis_svd.model import SVDAccessType, SVDCPUNameType
@@ -8,11 +9,16 @@ def instance_to_type(name):
     return f"{name}_t"
 
 def sized_int(bit_size):
-    return f"::bitfilled::sized_unsigned_t<{bit_size // 8}>"
+    # the fixed width types are cheaper to compile than the equivalent alias template
+    return f"std::uint{bit_size}_t"
 
 def is_bitband_range(address):
     return address >= 0x40000000 and address < 0x42000000
 
+def bitband_base(address):
+    # the base of the 512 MiB memory region (peripheral or SRAM) that contains the address
+    return address & 0xE0000000
+
 def convert_access(svd_access):
     match svd_access:
         case SVDAccessType.READ_ONLY:
@@ -22,17 +28,41 @@ def convert_access(svd_access):
         case SVDAccessType.READ_WRITE | SVDAccessType.READ_WRITE_ONCE | _:
             return "rw"
 
-def generate_peripheral(peripheral, bitband):
+def layout_id(name):
+    # the FNV-1a hash of the layout name, as bitfilled::layout_id() computes it
+    value = 2166136261
+    for byte in name.encode():
+        value = ((value ^ byte) * 16777619) & 0xFFFFFFFF
+    return value
+
+def generate_peripheral(peripheral, bitband, module=None, layouts=None):
     peripheral_name = peripheral.name
     if len(peripheral.group_name):
         peripheral_name = peripheral.group_name
 
     parts = []
+    if module:
+        string_view_include = "#include <string_view>\n" if layouts is not None else ""
+        # the layout metadata is provided by binlog.hpp, which only the host module exports
+        host_import = "import bitfilled.host;\n" if layouts is not None else ""
+        # the macros are taken from the global module fragment, the types from the module
+        parts.append(
+         "module;\n"
+         "#include <array>\n"
+         "#include <cstdint>\n"
+        f"{string_view_include}"
+         "#include <bitfilled/macros.hpp>\n"
+        f"export module {module}:{peripheral_name};\n"
+         "import bitfilled;\n"
+        f"{host_import}")
     parts.append(
-        f"struct {instance_to_type(peripheral_name)} {{")
+        f"{'export ' if module else ''}struct {instance_to_type(peripheral_name)} {{")
     # TODO: only use bitband if all peripherals of the chip are in bitband range
+    # the device header's PERIPH_BASE macro isn't visible in a module,
+    # use the base of the region containing the peripheral's base address from the SVD instead
+    periph_base = f"{bitband_base(peripheral.base_address):#010x}" if module else "PERIPH_BASE"
     parts.append(
-         "    using mmr_ops = ::bitfilled::bitband<PERIPH_BASE>;" if bitband and is_bitband_range(peripheral.base_address) else
+        f"    using mmr_ops = ::bitfilled::bitband<{periph_base}>;" if bitband and is_bitband_range(peripheral.base_address) else
          "    using mmr_ops = ::bitfilled::base;")
 
     # TODO: in the first round of iteration, generate enum types where enumeratedValues is provided
@@ -40,6 +70,7 @@ def generate_peripheral(peripheral, bitband):
 
     nametrim = peripheral_name + "_"
     offset = 0
+    layout_macros = []
     for register in peripheral.get_registers():
         # filling gaps in the register map with reserved
         if (offset < register.address_offset):
@@ -55,6 +86,8 @@ def generate_peripheral(peripheral, bitband):
         f"        BF_COPY_SUPERCLASS({regnametype});")
 
         # define register fields
+        layout = {"name": f"{instance_to_type(peripheral_name)}::{regnametype}",
+                  "size": register.size // 8, "fields": []}
         for field in register.get_fields():
             # TODO: group the fields into bitfieldset, if they are contiguous, share properties and are named accordingly
 
@@ -63,6 +96,15 @@ def generate_peripheral(peripheral, bitband):
             msb = field.bit_offset + field.bit_width - 1
             parts.append(
         f"        BF_MMREGBITS({sized_int(register.size)}, {convert_access(access)}, {lsb}, {msb}) {field.name};")
+            layout["fields"].append({"name": field.name, "first_bit": lsb, "width": field.bit_width,
+                                     "count": 1, "kind": "unsigned"})
+
+        # the layout metadata for decoding the binary logs of the register
+        if layouts is not None and layout["fields"]:
+            layout["id"] = layout_id(layout["name"])
+            layouts.append(layout)
+            field_names = ", ".join(field["name"] for field in layout["fields"])
+            layout_macros.append(f"BF_LAYOUT({layout['name']}, {field_names});")
 
         parts.append(
         f"    }} {regname};")
@@ -70,6 +112,7 @@ def generate_peripheral(peripheral, bitband):
 
     parts.append(
          "};")
+    parts.extend(layout_macros)
     return "\n".join(parts)
 
 if __name__ == "__main__":
@@ -86,6 +129,16 @@ if __name__ == "__main__":
         type=str,
         help="Name of the peripheral or peripheral group for code generation"
     )
+    parser.add_argument(
+        "--module",
+        type=str,
+        help="Generate a partition of this C++20 module (export import it from the primary module interface)"
+    )
+    parser.add_argument(
+        "--layouts",
+        type=pathlib.Path,
+        help="Generate the BF_LAYOUT metadata of the registers, and write it as JSON to this path (for tools/binlog_decode.py)"
+    )
 
     args = parser.parse_args()
 
@@ -99,7 +152,11 @@ if __name__ == "__main__":
 
     for peripheral in peripherals:
         if peripheral.name == args.peripheral or peripheral.group_name == args.peripheral:
-            print(generate_peripheral(peripheral, bitband_support))
+            layouts = [] if args.layouts else None
+            print(generate_peripheral(peripheral, bitband_support, args.module, layouts))
+            if args.layouts:
+                with open(args.layouts, "w") as file:
+                    json.dump({"layouts": layouts}, file, indent=2)
             exit(0)
 
     raise ValueError(f"Peripheral {args.peripheral} not found in the SVD file")
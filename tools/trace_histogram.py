@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MPL-2.0
+"""
+Summarizes the register operations recorded by bitfilled::traced (see trace_ring::dump()),
+into histograms of the register and field accesses, ordered by the bus access count.
+A modify operation is counted as two bus accesses (a read and a write).
+"""
+import argparse
+import collections
+import csv
+import sys
+
+KINDS = ("read", "write", "modify")
+BUS_ACCESSES = {"read": 1, "write": 1, "modify": 2}
+
+
+def load_names(path):
+    """Loads the address,name pairs of the registers."""
+    names = {}
+    with open(path, newline="") as file:
+        for row in csv.reader(file):
+            if len(row) >= 2 and not row[0].startswith("#"):
+                names[int(row[0], 0)] = row[1]
+    return names
+
+
+def load_records(paths):
+    for path in paths:
+        with (sys.stdin if path == "-" else open(path, newline="")) as file:
+            yield from csv.DictReader(file)
+
+
+def histogram(records, names):
+    registers = collections.defaultdict(collections.Counter)
+    fields = collections.defaultdict(collections.Counter)
+    for record in records:
+        address = int(record["address"], 0)
+        first, last = int(record["first_bit"]), int(record["last_bit"])
+        width_bits = int(record["width"]) * 8
+        register = names.get(address, f"0x{address:x}")
+        registers[register][record["kind"]] += 1
+        if first != 0 or last != width_bits - 1:
+            bits = f"{last}:{first}" if last != first else f"{first}"
+            fields[f"{register}[{bits}]"][record["kind"]] += 1
+    return registers, fields
+
+
+def print_histogram(title, counters, limit):
+    def bus(counter):
+        return sum(BUS_ACCESSES[kind] * count for kind, count in counter.items())
+
+    rows = sorted(counters.items(), key=lambda item: bus(item[1]), reverse=True)[:limit]
+    name_width = max([len(title)] + [len(name) for name, _ in rows])
+    print(f"{title:<{name_width}} " + " ".join(f"{kind:>8}" for kind in KINDS) + f" {'bus':>8}")
+    for name, counter in rows:
+        print(f"{name:<{name_width}} " + " ".join(f"{counter[kind]:>8}" for kind in KINDS)
+              + f" {bus(counter):>8}")
+    print()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("traces", nargs="*", default=["-"],
+                        help="the CSV dumps of the trace rings (default: stdin)")
+    parser.add_argument("--names", help="CSV file of address,name pairs naming the registers")
+    parser.add_argument("--top", type=int, default=20, help="the number of rows to print")
+    args = parser.parse_args()
+
+    names = load_names(args.names) if args.names else {}
+    registers, fields = histogram(load_records(args.traces), names)
+    print_histogram("register", registers, args.top)
+    print_histogram("field", fields, args.top)
+
+
+if __name__ == "__main__":
+    main()